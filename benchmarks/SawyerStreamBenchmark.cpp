@@ -0,0 +1,166 @@
+#include "S5/S5.h"
+#include "S5/SawyerStream.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco;
+
+namespace
+{
+    struct Chunk
+    {
+        std::string name;
+        std::vector<uint8_t> data;
+    };
+
+    constexpr const char* encodingNames[] = { "uncompressed", "runLengthSingle", "runLengthMulti", "rotate" };
+    constexpr int iterations = 5;
+
+    std::vector<uint8_t> toVector(stdx::span<uint8_t const> span)
+    {
+        return std::vector<uint8_t>(span.begin(), span.end());
+    }
+
+    // Reads the decoded chunks of an S5 file, skipping the headers of any packed objects
+    std::vector<Chunk> readS5Chunks(const fs::path& path)
+    {
+        std::vector<Chunk> chunks;
+        SawyerStreamReader reader(path);
+        if (!reader.validateChecksum())
+        {
+            std::fprintf(stderr, "Warning: invalid checksum\n");
+        }
+
+        auto headerData = reader.readChunk();
+        S5::Header header;
+        std::memcpy(&header, headerData.data(), std::min(sizeof(header), headerData.size()));
+        chunks.push_back({ "header", toVector(headerData) });
+
+        if (header.type == S5::S5Type::scenario || header.type == S5::S5Type::landscape)
+        {
+            chunks.push_back({ "options", toVector(reader.readChunk()) });
+        }
+        if (header.flags & S5::S5Flags::hasSaveDetails)
+        {
+            chunks.push_back({ "saveDetails", toVector(reader.readChunk()) });
+        }
+        for (uint16_t i = 0; i < header.numPackedObjects; i++)
+        {
+            ObjectHeader objectHeader;
+            reader.read(&objectHeader, sizeof(objectHeader));
+            chunks.push_back({ "packedObject", toVector(reader.readChunk()) });
+        }
+        chunks.push_back({ "requiredObjects", toVector(reader.readChunk()) });
+        if (header.type == S5::S5Type::scenario)
+        {
+            chunks.push_back({ "gameState1", toVector(reader.readChunk()) });
+            chunks.push_back({ "gameState2", toVector(reader.readChunk()) });
+            chunks.push_back({ "gameState3", toVector(reader.readChunk()) });
+        }
+        else
+        {
+            chunks.push_back({ "gameState", toVector(reader.readChunk()) });
+        }
+        chunks.push_back({ "tileElements", toVector(reader.readChunk()) });
+        return chunks;
+    }
+
+    // Something resembling tile elements when no save is given: mostly repeated 8 byte records
+    std::vector<Chunk> createSyntheticChunks()
+    {
+        std::mt19937 rng(0);
+        std::vector<uint8_t> tiles(0x6C000 * 8);
+        for (size_t i = 0; i < tiles.size(); i += 8)
+        {
+            tiles[i] = (rng() % 4) << 2;
+            tiles[i + 1] = (rng() % 16 == 0) ? 0x80 : 0;
+            tiles[i + 2] = static_cast<uint8_t>(16 + rng() % 4);
+            tiles[i + 3] = tiles[i + 2];
+            tiles[i + 4] = static_cast<uint8_t>(rng() % 3);
+        }
+        return { { "synthetic", tiles } };
+    }
+
+    double toMBps(size_t bytes, std::chrono::high_resolution_clock::duration duration)
+    {
+        auto seconds = std::chrono::duration<double>(duration).count();
+        return seconds > 0 ? (bytes / (1024.0 * 1024.0)) / seconds : 0;
+    }
+
+    // Returns false if a chunk does not survive an encode / decode round trip
+    bool benchmark(const std::vector<Chunk>& chunks)
+    {
+        bool valid = true;
+        FastBuffer encodeBuffer;
+        FastBuffer encodeBuffer2;
+        FastBuffer decodeBuffer;
+        FastBuffer decodeBuffer2;
+
+        std::printf("%-16s %-16s %10s %10s %12s %12s\n", "chunk", "encoding", "size", "encoded", "encode MB/s", "decode MB/s");
+        for (const auto& chunk : chunks)
+        {
+            for (uint8_t e = 0; e < std::size(encodingNames); e++)
+            {
+                auto encoding = static_cast<SawyerEncoding>(e);
+                std::chrono::high_resolution_clock::duration encodeTime{};
+                std::chrono::high_resolution_clock::duration decodeTime{};
+                std::vector<uint8_t> encoded;
+                for (int i = 0; i < iterations; i++)
+                {
+                    auto start = std::chrono::high_resolution_clock::now();
+                    encoded = toVector(SawyerStreamWriter::encode(encoding, chunk.data, encodeBuffer, encodeBuffer2));
+                    encodeTime += std::chrono::high_resolution_clock::now() - start;
+
+                    start = std::chrono::high_resolution_clock::now();
+                    auto decoded = SawyerStreamReader::decode(encoding, encoded, decodeBuffer, decodeBuffer2);
+                    decodeTime += std::chrono::high_resolution_clock::now() - start;
+
+                    if (decoded.size() != chunk.data.size() || !std::equal(decoded.begin(), decoded.end(), chunk.data.begin()))
+                    {
+                        std::fprintf(stderr, "Round trip failed: %s %s\n", chunk.name.c_str(), encodingNames[e]);
+                        valid = false;
+                        break;
+                    }
+                }
+
+                auto totalBytes = chunk.data.size() * iterations;
+                std::printf(
+                    "%-16s %-16s %10zu %10zu %12.1f %12.1f\n",
+                    chunk.name.c_str(),
+                    encodingNames[e],
+                    chunk.data.size(),
+                    encoded.size(),
+                    toMBps(totalBytes, encodeTime),
+                    toMBps(totalBytes, decodeTime));
+            }
+        }
+        return valid;
+    }
+}
+
+// Usage: sawyer-benchmark [file.SV5 ...]
+int main(int argc, const char** argv)
+{
+    try
+    {
+        bool valid = true;
+        if (argc < 2)
+        {
+            valid = benchmark(createSyntheticChunks());
+        }
+        for (int i = 1; i < argc; i++)
+        {
+            std::printf("%s\n", argv[i]);
+            valid &= benchmark(readS5Chunks(fs::u8path(argv[i])));
+        }
+        return valid ? 0 : 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+}
@@ -810,22 +810,20 @@ namespace OpenLoco::Audio
         return false;
     }
 
-    static void sub_48A274(Vehicles::Vehicle2or6* v)
+    // View space region in which a vehicle's driving sound is picked up and the window it plays for
+    struct AudibleRegion
     {
-        if (v == nullptr)
-            return;
-
-        if (v->drivingSoundId == SoundObjectId::null)
-            return;
-
-        // TODO: left or top?
-        if (v->sprite_left == Location::null)
-            return;
+        ViewportRect rect;
+        WindowType windowType;
+        window_number windowNumber;
+    };
 
-        if (_numActiveVehicleSounds >= Config::get().max_vehicle_sounds)
-            return;
+    // Built once per vehicle noise update, in the order sub_48A274 checks them
+    static std::vector<AudibleRegion> _audibleRegions;
 
-        auto spritePosition = viewport_pos(v->sprite_left, v->sprite_top);
+    static void updateAudibleRegions()
+    {
+        _audibleRegions.clear();
 
         auto main = WindowManager::getMainWindow();
         if (main != nullptr && main->viewports[0] != nullptr)
@@ -839,21 +837,9 @@ namespace OpenLoco::Audio
             extendedViewport.top = viewport->view_y - quarterHeight;
             extendedViewport.right = viewport->view_x + viewport->view_width + quarterWidth;
             extendedViewport.bottom = viewport->view_y + viewport->view_height + quarterHeight;
-
-            if (extendedViewport.contains(spritePosition))
-            {
-                // jump + return
-                _numActiveVehicleSounds += 1;
-                v->var_4A |= 1;
-                v->sound_window_type = main->type;
-                v->sound_window_number = main->number;
-                return;
-            }
+            _audibleRegions.push_back({ extendedViewport, main->type, main->number });
         }
 
-        if (WindowManager::count() == 0)
-            return;
-
         for (auto i = (int32_t)WindowManager::count() - 1; i >= 0; i--)
         {
             auto w = WindowManager::get(i);
@@ -868,12 +854,40 @@ namespace OpenLoco::Audio
             if (viewport == nullptr)
                 continue;
 
-            if (viewport->contains(spritePosition))
+            // Same as viewport::contains, which is inclusive on the left and top edges
+            ViewportRect rect = {};
+            rect.left = viewport->view_x - 1;
+            rect.top = viewport->view_y - 1;
+            rect.right = viewport->view_x + viewport->view_width - 1;
+            rect.bottom = viewport->view_y + viewport->view_height - 1;
+            _audibleRegions.push_back({ rect, w->type, w->number });
+        }
+    }
+
+    static void sub_48A274(Vehicles::Vehicle2or6* v)
+    {
+        if (v == nullptr)
+            return;
+
+        if (v->drivingSoundId == SoundObjectId::null)
+            return;
+
+        // TODO: left or top?
+        if (v->sprite_left == Location::null)
+            return;
+
+        if (_numActiveVehicleSounds >= Config::get().max_vehicle_sounds)
+            return;
+
+        auto spritePosition = viewport_pos(v->sprite_left, v->sprite_top);
+        for (auto& region : _audibleRegions)
+        {
+            if (region.rect.contains(spritePosition))
             {
                 _numActiveVehicleSounds += 1;
                 v->var_4A |= 1;
-                v->sound_window_type = w->type;
-                v->sound_window_number = w->number;
+                v->sound_window_type = region.windowType;
+                v->sound_window_number = region.windowNumber;
                 return;
             }
         }
@@ -926,6 +940,7 @@ namespace OpenLoco::Audio
         {
             if (!_audioIsPaused && _audioIsEnabled)
             {
+                updateAudibleRegions();
                 sub_48A1FA(0);
                 sub_48A1FA(1);
                 sub_48A1FA(2);
@@ -1,4 +1,6 @@
 #include "Company.h"
+#include "CompanyManager.h"
+#include "Console.h"
 #include "Entities/EntityManager.h"
 #include "Interop/Interop.hpp"
 #include "Localisation/FormatArguments.hpp"
@@ -8,6 +10,7 @@
 #include <algorithm>
 #include <array>
 #include <map>
+#include <type_traits>
 
 using namespace OpenLoco::Interop;
 
@@ -64,6 +67,37 @@ namespace OpenLoco
         Ui::WindowManager::invalidate(Ui::WindowType::company, companyId);
     }
 
+    // Same result as recalculateTransportCounts but from the counts CompanyManager keeps up to date
+    void Company::updateTransportCounts()
+    {
+        auto companyId = id();
+        for (uint8_t type = 0; type < std::size(transportTypeCount); type++)
+        {
+            transportTypeCount[type] = CompanyManager::getTransportCount(companyId, static_cast<VehicleType>(type));
+        }
+
+#ifndef NDEBUG
+        // Check the counts against a full rescan, a mismatch means a vehicle was created, freed or
+        // changed owner somewhere that did not update CompanyManager
+        uint16_t counted[std::extent_v<decltype(transportTypeCount)>]{};
+        for (auto v : EntityManager::VehicleList())
+        {
+            if (v->owner == companyId)
+            {
+                counted[static_cast<uint8_t>(v->vehicleType)]++;
+            }
+        }
+        if (!std::equal(std::begin(counted), std::end(counted), std::begin(transportTypeCount)))
+        {
+            Console::error("Transport counts of company %d are out of sync, recounting.", companyId);
+            CompanyManager::rebuildTransportCounts();
+            std::copy(std::begin(counted), std::end(counted), std::begin(transportTypeCount));
+        }
+#endif
+
+        Ui::WindowManager::invalidate(Ui::WindowType::company, companyId);
+    }
+
     // Converts performance index to rating
     // 0x00437D60
     // input:
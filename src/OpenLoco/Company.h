@@ -110,6 +110,7 @@ namespace OpenLoco
         void aiThink();
         bool isVehicleIndexUnlocked(const uint8_t vehicleIndex) const;
         void recalculateTransportCounts();
+        void updateTransportCounts();
     };
 #pragma pack(pop)
 
@@ -11,6 +11,7 @@
 #include "Ui/WindowManager.h"
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
+#include <type_traits>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui;
@@ -22,6 +23,11 @@ namespace OpenLoco::CompanyManager
     static loco_global<uint8_t, 0x00526214> _company_competition_delay;
     static loco_global<uint8_t, 0x00525FB7> _company_max_competing;
     static loco_global<Company[max_companies], 0x00531784> _companies;
+    static ActiveIdList<CompanyId_t, max_companies> _activeIds;
+
+    // Vehicles owned by each company by type. Kept up to date as vehicle heads are created and freed
+    // so that Company::transportTypeCount can be refreshed without scanning every vehicle.
+    static std::array<std::array<uint16_t, std::extent_v<decltype(Company::transportTypeCount)>>, max_companies> _transportCounts;
     static loco_global<uint8_t[max_companies + 1], 0x009C645C> _company_colours;
     static loco_global<CompanyId_t, 0x009C68EB> _updating_company_id;
 
@@ -31,6 +37,7 @@ namespace OpenLoco::CompanyManager
     void reset()
     {
         call(0x0042F7F8);
+        invalidateActiveIds();
     }
 
     CompanyId_t updatingCompanyId()
@@ -59,6 +66,17 @@ namespace OpenLoco::CompanyManager
         return nullptr;
     }
 
+    // The companies that are in use, in id order
+    ActiveObjectRange<Company, CompanyId_t> activeCompanies()
+    {
+        return ActiveObjectRange<Company, CompanyId_t>(&_companies[0], _activeIds.get(&_companies[0]));
+    }
+
+    void invalidateActiveIds()
+    {
+        _activeIds.invalidate();
+    }
+
     CompanyId_t getControllingId()
     {
         return _player_company[0];
@@ -105,6 +123,8 @@ namespace OpenLoco::CompanyManager
             {
                 updatingCompanyId(id);
                 company->aiThink();
+                // The AI may have sold off or wound up its company
+                invalidateActiveIds();
             }
 
             _byte_525FCB++;
@@ -121,6 +141,50 @@ namespace OpenLoco::CompanyManager
         call(0x0042F9AC);
     }
 
+    uint16_t getTransportCount(CompanyId_t id, VehicleType type)
+    {
+        if (id >= max_companies)
+        {
+            return 0;
+        }
+        return _transportCounts[id][static_cast<uint8_t>(type)];
+    }
+
+    void incrementTransportCount(CompanyId_t id, VehicleType type)
+    {
+        if (id >= max_companies)
+        {
+            return;
+        }
+        _transportCounts[id][static_cast<uint8_t>(type)]++;
+    }
+
+    void decrementTransportCount(CompanyId_t id, VehicleType type)
+    {
+        if (id >= max_companies)
+        {
+            return;
+        }
+        auto& count = _transportCounts[id][static_cast<uint8_t>(type)];
+        if (count != 0)
+        {
+            count--;
+        }
+    }
+
+    // Recounts every company's vehicles in a single pass over the vehicle list
+    void rebuildTransportCounts()
+    {
+        for (auto& counts : _transportCounts)
+        {
+            counts.fill(0);
+        }
+        for (auto v : EntityManager::VehicleList())
+        {
+            incrementTransportCount(v->owner, v->vehicleType);
+        }
+    }
+
     // 0x0042F23C
     currency32_t calculateDeliveredCargoPayment(uint8_t cargoItem, int32_t numUnits, int32_t distance, uint16_t numDays)
     {
@@ -136,11 +200,8 @@ namespace OpenLoco::CompanyManager
     // 0x0042FDE2
     void determineAvailableVehicles()
     {
-        for (auto& company : _companies)
+        for (auto& company : activeCompanies())
         {
-            if (company.empty())
-                continue;
-
             VehicleManager::determineAvailableVehicles(company);
         }
     }
@@ -151,10 +212,10 @@ namespace OpenLoco::CompanyManager
         if (_company_competition_delay == 0 && _company_max_competing != 0)
         {
             int32_t companies_active = 0;
-            for (const auto& company : companies())
+            for (const auto& company : activeCompanies())
             {
                 auto id = company.id();
-                if (!company.empty() && id != _player_company[0] && id != _player_company[1])
+                if (id != _player_company[0] && id != _player_company[1])
                 {
                     companies_active++;
                 }
@@ -168,6 +229,7 @@ namespace OpenLoco::CompanyManager
                 {
                     // Creates new company.
                     sub_42F9AC();
+                    invalidateActiveIds();
                 }
             }
         }
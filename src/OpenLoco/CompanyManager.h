@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Company.h"
+#include "Core/ActiveIdList.hpp"
 #include "Map/Map.hpp"
 #include "Types.hpp"
 #include <array>
@@ -16,6 +17,8 @@ namespace OpenLoco::CompanyManager
 
     std::array<Company, max_companies>& companies();
     Company* get(CompanyId_t id);
+    ActiveObjectRange<Company, CompanyId_t> activeCompanies();
+    void invalidateActiveIds();
     CompanyId_t getControllingId();
     CompanyId_t getSecondaryPlayerId();
     void setControllingId(CompanyId_t id);
@@ -25,6 +28,11 @@ namespace OpenLoco::CompanyManager
     uint8_t getPlayerCompanyColour();
     void update();
     void determineAvailableVehicles();
+
+    uint16_t getTransportCount(CompanyId_t id, VehicleType type);
+    void incrementTransportCount(CompanyId_t id, VehicleType type);
+    void decrementTransportCount(CompanyId_t id, VehicleType type);
+    void rebuildTransportCounts();
     currency32_t calculateDeliveredCargoPayment(uint8_t cargoItem, int32_t numUnits, int32_t distance, uint16_t numDays);
 
     struct OwnerStatus
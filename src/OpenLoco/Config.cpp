@@ -94,10 +94,16 @@ namespace OpenLoco::Config
             _new_config.autosave_frequency = config["autosave_frequency"].as<int32_t>();
         if (config["autosave_amount"])
             _new_config.autosave_amount = config["autosave_amount"].as<int32_t>();
+        if (config["autosave_background"])
+            _new_config.autosave_background = config["autosave_background"].as<bool>();
+        if (config["autosave_delta"])
+            _new_config.autosave_delta = config["autosave_delta"].as<bool>();
         if (config["showFPS"])
             _new_config.showFPS = config["showFPS"].as<bool>();
         if (config["uncapFPS"])
             _new_config.uncapFPS = config["uncapFPS"].as<bool>();
+        if (config["particleLimit"])
+            _new_config.particleLimit = config["particleLimit"].as<int32_t>();
 
         return _new_config;
     }
@@ -147,8 +153,11 @@ namespace OpenLoco::Config
         node["zoom_to_cursor"] = _new_config.zoom_to_cursor;
         node["autosave_frequency"] = _new_config.autosave_frequency;
         node["autosave_amount"] = _new_config.autosave_amount;
+        node["autosave_background"] = _new_config.autosave_background;
+        node["autosave_delta"] = _new_config.autosave_delta;
         node["showFPS"] = _new_config.showFPS;
         node["uncapFPS"] = _new_config.uncapFPS;
+        node["particleLimit"] = _new_config.particleLimit;
 
         std::ofstream stream(configPath);
         if (stream.is_open())
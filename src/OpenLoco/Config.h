@@ -157,8 +157,11 @@ namespace OpenLoco::Config
         bool zoom_to_cursor = true;
         int32_t autosave_frequency = 1;
         int32_t autosave_amount = 12;
+        bool autosave_background = true;
+        bool autosave_delta = false;
         bool showFPS = false;
         bool uncapFPS = false;
+        int32_t particleLimit = 4000; // At EntityManager::maxMiscEntities, no particles are dropped
     };
 
 #pragma pack(pop)
@@ -0,0 +1,127 @@
+/// @file
+/// Compact lists of the occupied slots of the fixed size object arrays (stations, towns, ...)
+/// so that passes over them do not have to touch every unused slot.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace OpenLoco
+{
+    // Ascending ids of the slots that are not empty(). Objects are still created and removed by the
+    // original code, so the list is rebuilt lazily after invalidate() which has to be called wherever
+    // that may have happened.
+    template<typename TId, size_t TMax>
+    class ActiveIdList
+    {
+    private:
+        std::shared_ptr<std::vector<TId>> _ids;
+        bool _valid = false;
+
+    public:
+        void invalidate()
+        {
+            _valid = false;
+        }
+
+        // Ranges hold on to the list they were given. If one is still being iterated the list is
+        // rebuilt into a new buffer, so the ids under a live iterator never change.
+        template<typename TObject>
+        std::shared_ptr<const std::vector<TId>> get(const TObject* objects)
+        {
+            if (!_valid)
+            {
+                if (_ids == nullptr || _ids.use_count() > 1)
+                {
+                    _ids = std::make_shared<std::vector<TId>>();
+                    _ids->reserve(TMax);
+                }
+                _ids->clear();
+                for (size_t i = 0; i < TMax; i++)
+                {
+                    if (!objects[i].empty())
+                    {
+                        _ids->push_back(static_cast<TId>(i));
+                    }
+                }
+                _valid = true;
+            }
+            return _ids;
+        }
+    };
+
+    // Iterates the objects of an id list. Objects that have been removed since the list was built
+    // are skipped, so removing an object during an iteration is safe. Objects created during an
+    // iteration are not visited by it.
+    template<typename TObject, typename TId>
+    class ActiveObjectRange
+    {
+    private:
+        TObject* _objects;
+        std::shared_ptr<const std::vector<TId>> _ids;
+
+    public:
+        class Iterator
+        {
+        private:
+            TObject* _objects;
+            const TId* _it;
+            const TId* _end;
+
+            void skipEmpty()
+            {
+                while (_it != _end && _objects[*_it].empty())
+                {
+                    ++_it;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = TObject;
+            using difference_type = std::ptrdiff_t;
+            using pointer = TObject*;
+            using reference = TObject&;
+
+            Iterator(TObject* objects, const TId* it, const TId* end)
+                : _objects(objects)
+                , _it(it)
+                , _end(end)
+            {
+                skipEmpty();
+            }
+
+            reference operator*() const { return _objects[*_it]; }
+            pointer operator->() const { return &_objects[*_it]; }
+
+            Iterator& operator++()
+            {
+                ++_it;
+                skipEmpty();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                auto res = *this;
+                ++(*this);
+                return res;
+            }
+
+            bool operator==(const Iterator& rhs) const { return _it == rhs._it; }
+            bool operator!=(const Iterator& rhs) const { return _it != rhs._it; }
+        };
+
+        ActiveObjectRange(TObject* objects, std::shared_ptr<const std::vector<TId>> ids)
+            : _objects(objects)
+            , _ids(std::move(ids))
+        {
+        }
+
+        Iterator begin() const { return Iterator(_objects, _ids->data(), _ids->data() + _ids->size()); }
+        Iterator end() const { return Iterator(_objects, _ids->data() + _ids->size(), _ids->data() + _ids->size()); }
+    };
+}
@@ -2,7 +2,10 @@
 #include "../Config.h"
 #include "../Graphics/Gfx.h"
 #include "../Interop/Interop.hpp"
+#include "../Map/Tile.h"
+#include "../Ui/WindowManager.h"
 #include "../ViewportManager.h"
+#include "EntityManager.h"
 #include <algorithm>
 
 using namespace OpenLoco;
@@ -11,12 +14,23 @@ using namespace OpenLoco::Interop;
 // 0x0046FC83
 void EntityBase::moveTo(const Map::Pos3& loc)
 {
-    registers regs;
-    regs.ax = loc.x;
-    regs.cx = loc.y;
-    regs.dx = loc.z;
-    regs.esi = (int32_t)this;
-    call(0x0046FC83, regs);
+    EntityManager::moveSpatialEntry(*this, loc);
+    position = loc;
+
+    if (loc.x == Location::null)
+    {
+        sprite_left = Location::null;
+    }
+    else
+    {
+        auto vpPos = Map::coordinate3dTo2d(loc.x, loc.y, loc.z, Ui::WindowManager::getCurrentRotation());
+        sprite_left = vpPos.x - var_14;
+        sprite_right = vpPos.x + var_14;
+        sprite_top = vpPos.y - var_09;
+        sprite_bottom = vpPos.y + var_15;
+    }
+
+    EntityManager::updateVehicleSpriteIndex(*this);
 }
 
 // 0x004CBB01
@@ -1,4 +1,5 @@
 #include "EntityManager.h"
+#include "../CompanyManager.h"
 #include "../Console.h"
 #include "../Entities/Misc.h"
 #include "../GameCommands/GameCommands.h"
@@ -6,8 +7,16 @@
 #include "../Localisation/StringIds.h"
 #include "../Map/Tile.h"
 #include "../OpenLoco.h"
+#include "../Platform/Platform.h"
+#include "../Ui/WindowManager.h"
 #include "../Vehicles/Vehicle.h"
+#include "../Vehicles/VehicleManager.h"
+#include "../ViewportManager.h"
 #include "EntityTweener.h"
+#include <array>
+#include <fstream>
+#include <optional>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -20,6 +29,48 @@ namespace OpenLoco::EntityManager
     loco_global<uint32_t, 0x01025A88> _entitySpatialCount;
     constexpr size_t _entitySpatialIndexNull = 0x40000;
 
+    // Vehicle sprites indexed by the top left of their bounds in view coordinates. A sprite smaller
+    // than a cell can only contain points in its own cell or the cells to the right and below.
+    constexpr int32_t spriteCellSize = 256;
+    constexpr int32_t spriteGridLeft = -16384;
+    constexpr int32_t spriteGridTop = -8192;
+    constexpr int32_t spriteGridColumns = 32768 / spriteCellSize;
+    constexpr int32_t spriteGridRows = 24576 / spriteCellSize;
+    // Sprites too large for the above are kept in this cell which is always searched
+    constexpr uint32_t spriteCellOversized = spriteGridColumns * spriteGridRows;
+    constexpr uint32_t spriteCellNull = std::numeric_limits<uint32_t>::max();
+    static std::array<std::vector<EntityId_t>, spriteGridColumns * spriteGridRows + 1> _spriteCells;
+    static std::array<uint32_t, maxEntities> _spriteCellOfEntity = [] {
+        std::array<uint32_t, maxEntities> cells;
+        cells.fill(spriteCellNull);
+        return cells;
+    }();
+    static std::array<uint32_t, maxEntities> _spriteSlotOfEntity;
+    // Rotation the sprite bounds were calculated for
+    static int32_t _spriteIndexRotation = -1;
+
+    // The lists that are in use, the other list types are unused
+    constexpr EntityListType statsLists[] = {
+        EntityListType::null,
+        EntityListType::nullMoney,
+        EntityListType::vehicleHead,
+        EntityListType::misc,
+        EntityListType::vehicle,
+    };
+
+    // List changes counted during the current tick, folded into _poolStats by updatePoolStats
+    struct PoolTickCounts
+    {
+        uint32_t allocations;
+        uint32_t frees;
+        uint32_t movedIn;
+        uint32_t movedOut;
+    };
+    static std::array<PoolStats, numEntityLists> _poolStats;
+    static std::array<PoolTickCounts, numEntityLists> _poolTickCounts;
+    static std::array<uint16_t, numEntityLists> _poolCountsAtTickStart;
+    static std::array<bool, numEntityLists> _poolFailureLogged;
+
     // 0x0046FDFD
     void reset()
     {
@@ -84,6 +135,7 @@ namespace OpenLoco::EntityManager
 
         resetSpatialIndex();
         EntityTweener::get().reset();
+        resetPoolStats();
     }
 
     EntityId_t firstId(EntityListType list)
@@ -137,10 +189,215 @@ namespace OpenLoco::EntityManager
         return _entitySpatialIndex[index];
     }
 
+    static bool removeFromSpatialIndex(EntityBase& entity, const size_t index)
+    {
+        auto* quadId = &_entitySpatialIndex[index];
+        _entitySpatialCount = 0;
+        while (*quadId < maxEntities)
+        {
+            auto* quadEnt = get<EntityBase>(*quadId);
+            if (quadEnt == &entity)
+            {
+                *quadId = entity.nextQuadrantId;
+                return true;
+            }
+            _entitySpatialCount++;
+            if (_entitySpatialCount > maxEntities)
+            {
+                break;
+            }
+            quadId = &quadEnt->nextQuadrantId;
+        }
+        return false;
+    }
+
+    static void insertToSpatialIndex(EntityBase& entity, const size_t index)
+    {
+        entity.nextQuadrantId = _entitySpatialIndex[index];
+        _entitySpatialIndex[index] = entity.id;
+    }
+
+    static int32_t getSpriteCellCoord(int32_t value, int32_t origin, int32_t numCells)
+    {
+        return std::clamp((value - origin) / spriteCellSize, 0, numCells - 1);
+    }
+
+    static uint32_t getSpriteCellIndex(const EntityBase& entity)
+    {
+        if (entity.base_type != EntityBaseType::vehicle || entity.sprite_left == Location::null)
+        {
+            return spriteCellNull;
+        }
+        if (entity.sprite_right - entity.sprite_left >= spriteCellSize || entity.sprite_bottom - entity.sprite_top >= spriteCellSize)
+        {
+            return spriteCellOversized;
+        }
+        auto cellX = getSpriteCellCoord(entity.sprite_left, spriteGridLeft, spriteGridColumns);
+        auto cellY = getSpriteCellCoord(entity.sprite_top, spriteGridTop, spriteGridRows);
+        return cellY * spriteGridColumns + cellX;
+    }
+
+    static void removeFromSpriteIndex(const EntityBase& entity)
+    {
+        if (entity.id >= maxEntities)
+            return;
+
+        auto cellIndex = _spriteCellOfEntity[entity.id];
+        if (cellIndex == spriteCellNull)
+            return;
+
+        auto& cell = _spriteCells[cellIndex];
+        auto slot = _spriteSlotOfEntity[entity.id];
+        auto lastId = cell.back();
+        cell[slot] = lastId;
+        _spriteSlotOfEntity[lastId] = slot;
+        cell.pop_back();
+        _spriteCellOfEntity[entity.id] = spriteCellNull;
+    }
+
+    // Keeps the vehicle sprite index up to date with the entity's sprite bounds
+    void updateVehicleSpriteIndex(const EntityBase& entity)
+    {
+        if (entity.id >= maxEntities)
+            return;
+
+        auto cellIndex = getSpriteCellIndex(entity);
+        if (_spriteCellOfEntity[entity.id] == cellIndex)
+            return;
+
+        removeFromSpriteIndex(entity);
+        if (cellIndex != spriteCellNull)
+        {
+            auto& cell = _spriteCells[cellIndex];
+            _spriteCellOfEntity[entity.id] = cellIndex;
+            _spriteSlotOfEntity[entity.id] = static_cast<uint32_t>(cell.size());
+            cell.push_back(entity.id);
+        }
+    }
+
+    static void rebuildVehicleSpriteIndex()
+    {
+        for (auto& cell : _spriteCells)
+        {
+            cell.clear();
+        }
+        _spriteCellOfEntity.fill(spriteCellNull);
+
+        for (EntityId_t id = 0; id < maxEntities; id++)
+        {
+            updateVehicleSpriteIndex(_entities[id]);
+        }
+        _spriteIndexRotation = Ui::WindowManager::getCurrentRotation();
+    }
+
+    // Fills result with the vehicle entities whose sprite bounds contain the view position
+    void getVehicleSpritesAt(int16_t viewX, int16_t viewY, std::vector<EntityBase*>& result)
+    {
+        result.clear();
+        if (_spriteIndexRotation != Ui::WindowManager::getCurrentRotation())
+        {
+            rebuildVehicleSpriteIndex();
+        }
+
+        auto addCell = [viewX, viewY, &result](uint32_t cellIndex) {
+            for (auto id : _spriteCells[cellIndex])
+            {
+                auto* entity = get<EntityBase>(id);
+                if (entity->sprite_left < viewX && entity->sprite_top < viewY && entity->sprite_right >= viewX && entity->sprite_bottom >= viewY)
+                {
+                    result.push_back(entity);
+                }
+            }
+        };
+
+        auto cellX = getSpriteCellCoord(viewX, spriteGridLeft, spriteGridColumns);
+        auto cellY = getSpriteCellCoord(viewY, spriteGridTop, spriteGridRows);
+        for (auto y = std::max(cellY - 1, 0); y <= cellY; y++)
+        {
+            for (auto x = std::max(cellX - 1, 0); x <= cellX; x++)
+            {
+                addCell(y * spriteGridColumns + x);
+            }
+        }
+        addCell(spriteCellOversized);
+    }
+
     // 0x0046FF54
     void resetSpatialIndex()
     {
-        call(0x0046FF54);
+        std::fill_n(_entitySpatialIndex.get(), 0x40001, EntityId::null);
+
+        for (EntityId_t id = 0; id < maxEntities; id++)
+        {
+            auto& entity = _entities[id];
+            if (entity.base_type == EntityBaseType::null)
+            {
+                continue;
+            }
+            insertToSpatialIndex(entity, getSpatialIndexOffset(entity.position));
+        }
+        rebuildVehicleSpriteIndex();
+    }
+
+    // Part of 0x0046FC83
+    void moveSpatialEntry(EntityBase& entity, const Map::Pos2& loc)
+    {
+        const auto newIndex = getSpatialIndexOffset(loc);
+        const auto oldIndex = getSpatialIndexOffset(entity.position);
+        if (newIndex != oldIndex)
+        {
+            if (!removeFromSpatialIndex(entity, oldIndex))
+            {
+                Console::log("Invalid quadrant ids... Reseting spatial index.");
+                resetSpatialIndex();
+                moveSpatialEntry(entity, loc);
+                return;
+            }
+            insertToSpatialIndex(entity, newIndex);
+        }
+    }
+
+    static bool isFreeList(const EntityListType list)
+    {
+        return list == EntityListType::null || list == EntityListType::nullMoney;
+    }
+
+    // Taking an entity out of a free list counts as an allocation for both lists, returning one as
+    // a free for both
+    static void recordListMove(const EntityListType from, const EntityListType to)
+    {
+        auto& fromCounts = _poolTickCounts[static_cast<size_t>(from)];
+        auto& toCounts = _poolTickCounts[static_cast<size_t>(to)];
+        if (isFreeList(from) && !isFreeList(to))
+        {
+            fromCounts.allocations++;
+            toCounts.allocations++;
+        }
+        else if (!isFreeList(from) && isFreeList(to))
+        {
+            fromCounts.frees++;
+            toCounts.frees++;
+        }
+        else
+        {
+            fromCounts.movedOut++;
+            toCounts.movedIn++;
+        }
+
+        auto& fromStats = _poolStats[static_cast<size_t>(from)];
+        fromStats.lowWater = std::min(fromStats.lowWater, getListCount(from));
+        auto& toStats = _poolStats[static_cast<size_t>(to)];
+        toStats.highWater = std::max(toStats.highWater, getListCount(to));
+    }
+
+    static void recordPoolFailure(const EntityListType list)
+    {
+        _poolStats[static_cast<size_t>(list)].failures++;
+        if (!_poolFailureLogged[static_cast<size_t>(list)])
+        {
+            _poolFailureLogged[static_cast<size_t>(list)] = true;
+            Console::error("Entity list '%s' ran out (%u of %u), entities are failing to be created.", getListName(list), getListCount(list), static_cast<uint32_t>(getListCapacity(list)));
+        }
     }
 
     static EntityBase* createEntity(EntityId_t id, EntityListType list)
@@ -174,10 +431,12 @@ namespace OpenLoco::EntityManager
     {
         if (getListCount(EntityListType::misc) >= maxMiscEntities)
         {
+            recordPoolFailure(EntityListType::misc);
             return nullptr;
         }
         if (getListCount(EntityListType::null) <= 0)
         {
+            recordPoolFailure(EntityListType::misc);
             return nullptr;
         }
 
@@ -190,6 +449,7 @@ namespace OpenLoco::EntityManager
     {
         if (getListCount(EntityListType::nullMoney) <= 0)
         {
+            recordPoolFailure(EntityListType::nullMoney);
             return nullptr;
         }
 
@@ -202,6 +462,7 @@ namespace OpenLoco::EntityManager
     {
         if (getListCount(EntityListType::null) <= 0)
         {
+            recordPoolFailure(EntityListType::vehicle);
             return nullptr;
         }
 
@@ -212,6 +473,13 @@ namespace OpenLoco::EntityManager
     // 0x0047024A
     void freeEntity(EntityBase* const entity)
     {
+        auto* vehicle = entity->asVehicle();
+        if (vehicle != nullptr && vehicle->isVehicleHead())
+        {
+            auto* head = vehicle->asVehicleHead();
+            CompanyManager::decrementTransportCount(head->owner, head->vehicleType);
+        }
+
         EntityTweener::get().removeEntity(entity);
 
         auto list = entity->id < 19800 ? EntityListType::null : EntityListType::nullMoney;
@@ -220,25 +488,12 @@ namespace OpenLoco::EntityManager
         entity->base_type = EntityBaseType::null;
 
         // Remove from spatial lists
-        auto* quadId = &_entitySpatialIndex[getSpatialIndexOffset(entity->position)];
-        _entitySpatialCount = 0;
-        while (*quadId < maxEntities)
+        removeFromSpriteIndex(*entity);
+        if (!removeFromSpatialIndex(*entity, getSpatialIndexOffset(entity->position)))
         {
-            auto* quadEnt = get<EntityBase>(*quadId);
-            if (quadEnt == entity)
-            {
-                *quadId = entity->nextQuadrantId;
-                return;
-            }
-            _entitySpatialCount++;
-            if (_entitySpatialCount > maxEntities)
-            {
-                break;
-            }
-            quadId = &quadEnt->nextQuadrantId;
+            Console::log("Invalid quadrant ids... Reseting spatial index.");
+            resetSpatialIndex();
         }
-        Console::log("Invalid quadrant ids... Reseting spatial index.");
-        resetSpatialIndex();
     }
 
     // 0x004A8826
@@ -246,22 +501,40 @@ namespace OpenLoco::EntityManager
     {
         if ((addr<0x00525E28, uint32_t>() & 1) && !isEditorMode())
         {
+            VehicleManager::updateDrivingSounds();
             for (auto v : VehicleList())
             {
-                v->updateVehicle();
+                v->updateVehicle(true);
             }
         }
     }
 
+    // Bounds how long sprite invalidations of a run of particles are held back
+    static constexpr size_t maxParticleBatchSize = 64;
+
     // 0x004402F4
     void updateMiscEntities()
     {
         if ((addr<0x00525E28, uint32_t>() & 1))
         {
+            // Particles are created in runs (e.g. the exhaust puffs of one locomotive) and follow
+            // each other in the list, so each run of the same type is updated as a batch with the
+            // sprite invalidations merged. The list order is kept as the updates may use the PRNG.
+            std::optional<MiscEntityType> batchType;
+            size_t batchSize = 0;
             for (auto* misc : EntityList<EntityListIterator<MiscBase>, EntityListType::misc>())
             {
+                if (misc->getSubType() != batchType || batchSize >= maxParticleBatchSize)
+                {
+                    Ui::ViewportManager::endEntityInvalidationBatch();
+                    Ui::ViewportManager::beginEntityInvalidationBatch();
+                    batchType = misc->getSubType();
+                    batchSize = 0;
+                }
                 misc->update();
+                batchSize++;
             }
+            Ui::ViewportManager::endEntityInvalidationBatch();
         }
     }
 
@@ -329,6 +602,8 @@ namespace OpenLoco::EntityManager
 
         _listCounts[curList]--;
         _listCounts[static_cast<uint8_t>(list)]++;
+
+        recordListMove(static_cast<EntityListType>(curList), list);
     }
 
     // 0x00470188
@@ -336,6 +611,7 @@ namespace OpenLoco::EntityManager
     {
         if (EntityManager::getListCount(EntityManager::EntityListType::null) <= numNewEntities)
         {
+            recordPoolFailure(EntityListType::vehicle);
             GameCommands::setErrorText(StringIds::too_many_objects_in_game);
             return false;
         }
@@ -356,6 +632,129 @@ namespace OpenLoco::EntityManager
         ent->linkedListOffset = llOffset;
     }
 
+    size_t getListCapacity(const EntityListType list)
+    {
+        switch (list)
+        {
+            case EntityListType::null:
+            case EntityListType::vehicleHead:
+            case EntityListType::vehicle:
+                return maxNormalEntities;
+            case EntityListType::nullMoney:
+                return maxMoneyEntities;
+            case EntityListType::misc:
+                return maxMiscEntities;
+        }
+        return 0;
+    }
+
+    const char* getListName(const EntityListType list)
+    {
+        switch (list)
+        {
+            case EntityListType::null:
+                return "free";
+            case EntityListType::nullMoney:
+                return "free money";
+            case EntityListType::vehicleHead:
+                return "vehicle heads";
+            case EntityListType::misc:
+                return "misc";
+            case EntityListType::vehicle:
+                return "vehicles";
+        }
+        return "unused";
+    }
+
+    const PoolStats& getPoolStats(const EntityListType list)
+    {
+        return _poolStats[static_cast<size_t>(list)];
+    }
+
+    void resetPoolStats()
+    {
+        for (size_t i = 0; i < numEntityLists; i++)
+        {
+            const auto count = _listCounts[i];
+            _poolStats[i] = PoolStats{};
+            _poolStats[i].lowWater = count;
+            _poolStats[i].highWater = count;
+            _poolTickCounts[i] = PoolTickCounts{};
+            _poolCountsAtTickStart[i] = count;
+            _poolFailureLogged[i] = false;
+        }
+    }
+
+    // Called once per tick. Entities are still created by the original code without going through
+    // moveEntityToList, those are found from the difference between the list counts and the changes
+    // that were counted. Water marks only see the counts those entities leave at the end of the tick.
+    void updatePoolStats()
+    {
+        for (size_t i = 0; i < numEntityLists; i++)
+        {
+            const auto list = static_cast<EntityListType>(i);
+            const auto count = static_cast<int32_t>(_listCounts[i]);
+            auto& tick = _poolTickCounts[i];
+            auto& stats = _poolStats[i];
+
+            auto expected = static_cast<int32_t>(_poolCountsAtTickStart[i]) + static_cast<int32_t>(tick.movedIn) - static_cast<int32_t>(tick.movedOut);
+            if (isFreeList(list))
+            {
+                expected += static_cast<int32_t>(tick.frees) - static_cast<int32_t>(tick.allocations);
+                if (count < expected)
+                    tick.allocations += expected - count;
+                else
+                    tick.frees += count - expected;
+            }
+            else
+            {
+                expected += static_cast<int32_t>(tick.allocations) - static_cast<int32_t>(tick.frees);
+                if (count > expected)
+                    tick.allocations += count - expected;
+                else
+                    tick.frees += expected - count;
+            }
+
+            stats.allocations += tick.allocations;
+            stats.frees += tick.frees;
+            stats.allocationsLastTick = tick.allocations;
+            stats.freesLastTick = tick.frees;
+            stats.lowWater = std::min<uint16_t>(stats.lowWater, count);
+            stats.highWater = std::max<uint16_t>(stats.highWater, count);
+
+            tick = PoolTickCounts{};
+            _poolCountsAtTickStart[i] = count;
+        }
+    }
+
+    // Appends the current stats of every list to entity_pools.csv in the user directory
+    void dumpPoolStats()
+    {
+        const auto path = platform::getUserDirectory() / "entity_pools.csv";
+        const bool isNewFile = !fs::exists(path);
+
+        std::ofstream stream(path, std::ios::app);
+        if (!stream.is_open())
+        {
+            Console::error("Unable to write entity pool stats to %s", path.string().c_str());
+            return;
+        }
+
+        if (isNewFile)
+        {
+            stream << "ticks,list,count,capacity,low_water,high_water,allocations,frees,failures,allocations_last_tick,frees_last_tick" << std::endl;
+        }
+        for (const auto list : statsLists)
+        {
+            const auto& stats = getPoolStats(list);
+            stream << scenarioTicks() << ',' << getListName(list) << ',' << getListCount(list) << ',' << getListCapacity(list) << ','
+                   << stats.lowWater << ',' << stats.highWater << ',' << stats.allocations << ',' << stats.frees << ',' << stats.failures << ','
+                   << stats.allocationsLastTick << ',' << stats.freesLastTick << std::endl;
+        }
+
+        Console::log("Entity pool stats written to %s", path.string().c_str());
+    }
+
     // 0x0046FED5
     void zeroUnused()
     {
@@ -4,6 +4,7 @@
 #include "Entity.h"
 #include <cstdio>
 #include <iterator>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -51,6 +52,10 @@ namespace OpenLoco::EntityManager
 
     EntityId_t firstQuadrantId(const Map::Pos2& loc);
     void resetSpatialIndex();
+    void moveSpatialEntry(EntityBase& entity, const Map::Pos2& loc);
+
+    void updateVehicleSpriteIndex(const EntityBase& entity);
+    void getVehicleSpritesAt(int16_t viewX, int16_t viewY, std::vector<EntityBase*>& result);
 
     EntityBase* createEntityMisc();
     EntityBase* createEntityMoney();
@@ -65,6 +70,25 @@ namespace OpenLoco::EntityManager
     bool checkNumFreeEntities(const size_t numNewEntities);
     void zeroUnused();
 
+    // Occupancy and churn of an entity list since the stats were last reset
+    struct PoolStats
+    {
+        uint32_t allocations;
+        uint32_t frees;
+        uint32_t failures; // Entities that could not be created because the list was full or, for the free lists, empty
+        uint16_t lowWater;
+        uint16_t highWater;
+        uint32_t allocationsLastTick;
+        uint32_t freesLastTick;
+    };
+
+    size_t getListCapacity(const EntityListType list);
+    const char* getListName(const EntityListType list);
+    const PoolStats& getPoolStats(const EntityListType list);
+    void resetPoolStats();
+    void updatePoolStats();
+    void dumpPoolStats();
+
     template<typename TEntityType, EntityId_t EntityBase::*nextList>
     class ListIterator
     {
@@ -1,17 +1,24 @@
 #include "EntityTweener.h"
 #include "../OpenLoco.h"
 #include "../Vehicles/Vehicle.h"
+#include "../ViewportManager.h"
 #include "Entity.h"
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 namespace OpenLoco
 {
     using EntityListType = EntityManager::EntityListType;
     using EntityListIterator = EntityManager::ListIterator<EntityBase, &EntityBase::next_thing_id>;
 
+    constexpr uint32_t nullSlot = std::numeric_limits<uint32_t>::max();
+
+    // Entities move a few units per tick at most, allow for that when culling against the sprite bounds
+    constexpr int16_t visibilityMargin = 32;
+
     template<EntityListType id, typename Pred>
-    void PopulateEntities(std::vector<EntityBase*>& list, std::vector<Map::Pos3>& posList, const Pred& pred)
+    void PopulateEntities(EntityTweener& tweener, void (EntityTweener::*add)(EntityBase*), const Pred& pred)
     {
         auto entsView = EntityManager::EntityList<EntityListIterator, id>();
         for (auto* ent : entsView)
@@ -19,8 +26,7 @@ namespace OpenLoco
             if (!pred(ent))
                 continue;
 
-            list.push_back(ent);
-            posList.emplace_back(ent->position);
+            (tweener.*add)(ent);
         }
     }
 
@@ -35,8 +41,8 @@ namespace OpenLoco
     {
         restore();
         reset();
-        PopulateEntities<EntityListType::misc>(_entities, _prePos, [](auto* ent) { return true; });
-        PopulateEntities<EntityListType::vehicle>(_entities, _prePos, [](auto* ent) {
+        PopulateEntities<EntityListType::misc>(*this, &EntityTweener::addEntity, [](auto* ent) { return true; });
+        PopulateEntities<EntityListType::vehicle>(*this, &EntityTweener::addEntity, [](auto* ent) {
             const auto* vehicle = ent->asVehicle();
             if (vehicle == nullptr)
             {
@@ -63,19 +69,52 @@ namespace OpenLoco
         }
     }
 
+    void EntityTweener::addEntity(EntityBase* entity)
+    {
+        if (_slots.empty())
+        {
+            _slots.resize(EntityManager::maxEntities, nullSlot);
+        }
+
+        _slots[entity->id] = static_cast<uint32_t>(_entities.size());
+        _entities.push_back(entity);
+        _prePos.push_back(entity->position);
+    }
+
     void EntityTweener::removeEntity(const EntityBase* entity)
     {
-        auto it = std::find(_entities.begin(), _entities.end(), entity);
-        if (it != _entities.end())
+        if (entity->id >= _slots.size())
+            return;
+
+        auto& slot = _slots[entity->id];
+        if (slot != nullSlot && _entities[slot] == entity)
         {
-            *it = nullptr;
+            _entities[slot] = nullptr;
         }
+        slot = nullSlot;
+    }
+
+    bool EntityTweener::isVisible(const EntityBase* entity) const
+    {
+        if (entity->sprite_left == Location::null)
+            return false;
+
+        for (const auto& rect : _visibleRects)
+        {
+            if (entity->sprite_right + visibilityMargin >= rect.left && entity->sprite_left - visibilityMargin < rect.right && entity->sprite_bottom + visibilityMargin >= rect.top && entity->sprite_top - visibilityMargin < rect.bottom)
+            {
+                return true;
+            }
+        }
+        return false;
     }
 
     void EntityTweener::tween(float alpha)
     {
         const float inv = (1.0f - alpha);
 
+        Ui::ViewportManager::getVisibleRects(_visibleRects);
+
         for (size_t i = 0; i < _entities.size(); ++i)
         {
             auto* ent = _entities[i];
@@ -88,6 +127,10 @@ namespace OpenLoco
             if (posA == posB)
                 continue;
 
+            // Off screen entities are left at their post tick position
+            if (!isVisible(ent))
+                continue;
+
             auto newPos = Map::Pos3{ static_cast<int16_t>(std::round(posB.x * alpha + posA.x * inv)),
                                      static_cast<int16_t>(std::round(posB.y * alpha + posA.y * inv)),
                                      static_cast<int16_t>(std::round(posB.z * alpha + posA.z * inv)) };
@@ -120,6 +163,13 @@ namespace OpenLoco
 
     void EntityTweener::reset()
     {
+        for (auto* ent : _entities)
+        {
+            if (ent != nullptr)
+            {
+                _slots[ent->id] = nullSlot;
+            }
+        }
         _entities.clear();
         _prePos.clear();
         _postPos.clear();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Map/Map.hpp"
+#include "../Viewport.hpp"
 #include "EntityManager.h"
 #include <vector>
 
@@ -11,6 +12,13 @@ namespace OpenLoco
         std::vector<EntityBase*> _entities;
         std::vector<Map::Pos3> _prePos;
         std::vector<Map::Pos3> _postPos;
+        // Index into the above for each entity id, so entities can be removed without searching
+        std::vector<uint32_t> _slots;
+        // Views of the visible viewports, refreshed every tween
+        std::vector<Ui::ViewportRect> _visibleRects;
+
+        void addEntity(EntityBase* entity);
+        bool isVisible(const EntityBase* entity) const;
 
     public:
         static EntityTweener& get();
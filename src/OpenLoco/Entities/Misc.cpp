@@ -1,9 +1,11 @@
 #include "Misc.h"
+#include "../Config.h"
 #include "../Localisation/FormatArguments.hpp"
 #include "../Map/TileManager.h"
 #include "../Objects/ObjectManager.h"
 #include "../Ui/WindowManager.h"
 #include "EntityManager.h"
+#include <algorithm>
 
 using namespace OpenLoco::Interop;
 
@@ -17,6 +19,48 @@ namespace OpenLoco
         call(0x004405CD, regs);
     }
 
+    static int32_t _particleThinning;
+
+    void resetParticleLimit()
+    {
+        _particleThinning = 0;
+    }
+
+    // Decides whether a purely cosmetic particle (exhaust, smoke) may be created. The limit applies
+    // to the whole misc entity list, which also holds money effects and crash debris, as that is
+    // the pool the particles would run out. Beyond three quarters of the configured limit a
+    // decreasing share of them is dropped, so that busy maps thin out their steam gradually rather
+    // than all at once. At the default limit of the full pool nothing is dropped, as in the original.
+    static bool canCreateParticle()
+    {
+        const auto limit = std::clamp<int32_t>(Config::getNew().particleLimit, 0, EntityManager::maxMiscEntities);
+        if (limit == static_cast<int32_t>(EntityManager::maxMiscEntities))
+        {
+            return true;
+        }
+
+        const auto count = static_cast<int32_t>(EntityManager::getListCount(EntityManager::EntityListType::misc));
+        if (count >= limit)
+        {
+            return false;
+        }
+
+        const auto softLimit = limit - limit / 4;
+        if (count < softLimit)
+        {
+            return true;
+        }
+
+        // Let (limit - count) out of every (limit - softLimit) particles through, spread evenly
+        _particleThinning += limit - count;
+        if (_particleThinning >= limit - softLimit)
+        {
+            _particleThinning -= limit - softLimit;
+            return true;
+        }
+        return false;
+    }
+
     SteamObject* Exhaust::object() const
     {
         return ObjectManager::get<SteamObject>(object_id & 0x7F);
@@ -35,6 +79,9 @@ namespace OpenLoco
         if (loc.z <= surface->baseZ() * 4)
             return nullptr;
 
+        if (!canCreateParticle())
+            return nullptr;
+
         auto _exhaust = static_cast<Exhaust*>(EntityManager::createEntityMisc());
 
         if (_exhaust != nullptr)
@@ -59,6 +106,9 @@ namespace OpenLoco
     // 0x00440BEB
     Smoke* Smoke::create(Map::Pos3 loc)
     {
+        if (!canCreateParticle())
+            return nullptr;
+
         auto t = static_cast<Smoke*>(EntityManager::createEntityMisc());
         if (t != nullptr)
         {
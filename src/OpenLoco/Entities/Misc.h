@@ -134,4 +134,6 @@ namespace OpenLoco
     };
     static_assert(sizeof(Smoke) == 0x2A);
 #pragma pack(pop)
+
+    void resetParticleLimit();
 }
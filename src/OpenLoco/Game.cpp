@@ -2,6 +2,7 @@
 #include "Audio/Audio.h"
 #include "CompanyManager.h"
 #include "Config.h"
+#include "Environment.h"
 #include "GameCommands/GameCommands.h"
 #include "GameException.hpp"
 #include "Input.h"
@@ -167,6 +168,18 @@ namespace OpenLoco::Game
                 auto path = fs::path(&_savePath[0]).replace_extension(S5::extensionSV5).u8string();
                 std::strncpy(&_currentScenarioFilename[0], path.c_str(), std::size(_currentScenarioFilename));
 
+                // Delta autosaves are turned back into a full save that the original loader understands
+                if (S5::isDeltaFile(fs::u8path(path)))
+                {
+                    auto rebuiltPath = Environment::getPath(Environment::path_id::autosave) / "rebuilt_autosave.SV5";
+                    if (!S5::rebuildFromDeltaChain(fs::u8path(path), rebuiltPath))
+                    {
+                        Gfx::invalidateScreen();
+                        return;
+                    }
+                    std::strncpy(&_savePath[0], rebuiltPath.u8string().c_str(), std::size(_savePath));
+                }
+
                 if (sub_441FA7(0))
                 {
                     resetScreenAge();
@@ -39,9 +39,9 @@ namespace OpenLoco::GameCommands
             }
 
             // Second phase: change ownership of all stations that currently belong to the target company.
-            for (auto& station : StationManager::stations())
+            for (auto& station : StationManager::activeStations())
             {
-                if (station.empty() || station.owner != targetCompanyId)
+                if (station.owner != targetCompanyId)
                     continue;
 
                 station.owner = ourCompanyId;
@@ -54,6 +54,8 @@ namespace OpenLoco::GameCommands
                     continue;
 
                 Vehicles::Vehicle train(vehicle);
+                CompanyManager::decrementTransportCount(targetCompanyId, train.head->vehicleType);
+                CompanyManager::incrementTransportCount(ourCompanyId, train.head->vehicleType);
                 train.head->owner = ourCompanyId;
                 train.veh1->owner = ourCompanyId;
                 train.veh2->owner = ourCompanyId;
@@ -69,6 +71,8 @@ namespace OpenLoco::GameCommands
                     }
                 }
             }
+            CompanyManager::get(targetCompanyId)->updateTransportCounts();
+            CompanyManager::get(ourCompanyId)->updateTransportCounts();
 
             return 0;
         }
@@ -2,13 +2,16 @@
 #include "../Audio/Audio.h"
 #include "../Company.h"
 #include "../CompanyManager.h"
+#include "../IndustryManager.h"
 #include "../Localisation/FormatArguments.hpp"
 #include "../Map/Tile.h"
 #include "../Objects/ObjectManager.h"
 #include "../Objects/RoadObject.h"
 #include "../Objects/TrackObject.h"
 #include "../StationManager.h"
+#include "../TownManager.h"
 #include "../Ui/WindowManager.h"
+#include "../Vehicles/Orders.h"
 #include "../Vehicles/Vehicle.h"
 #include <cassert>
 
@@ -144,6 +147,66 @@ namespace OpenLoco::GameCommands
             });
     }
 
+    static bool commandModifiesOrders(GameCommand command)
+    {
+        switch (command)
+        {
+            case GameCommand::vehicleOrderInsert:
+            case GameCommand::vehicleOrderDelete:
+            case GameCommand::vehicleOrderSkip:
+            case GameCommand::vehicleOrderUp:
+            case GameCommand::vehicleOrderDown:
+            case GameCommand::vehicleCreate:
+            case GameCommand::vehicleSell:
+            case GameCommand::vehicleClone:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Commands that are known not to create or remove stations, towns, industries or companies
+    static bool commandKeepsActiveObjects(GameCommand command)
+    {
+        switch (command)
+        {
+            case GameCommand::vehicleRearrange:
+            case GameCommand::vehiclePlace:
+            case GameCommand::vehiclePickup:
+            case GameCommand::vehicleReverse:
+            case GameCommand::vehiclePassSignal:
+            case GameCommand::vehicleCreate:
+            case GameCommand::vehicleSell:
+            case GameCommand::changeLoan:
+            case GameCommand::vehicleRename:
+            case GameCommand::changeStationName:
+            case GameCommand::vehicleLocalExpress:
+            case GameCommand::changeCompanyColourScheme:
+            case GameCommand::pauseGame:
+            case GameCommand::changeCompanyName:
+            case GameCommand::changeCompanyOwnerName:
+            case GameCommand::vehicleOrderInsert:
+            case GameCommand::vehicleOrderDelete:
+            case GameCommand::vehicleOrderSkip:
+            case GameCommand::renameTown:
+            case GameCommand::vehicleAbortPickupAir:
+            case GameCommand::vehicleAbortPickupWater:
+            case GameCommand::vehicleRefit:
+            case GameCommand::changeCompanyFace:
+            case GameCommand::sendChatMessage:
+            case GameCommand::updateOwnerStatus:
+            case GameCommand::vehicleSpeedControl:
+            case GameCommand::vehicleOrderUp:
+            case GameCommand::vehicleOrderDown:
+            case GameCommand::applyFreeCashCheat:
+            case GameCommand::renameIndustry:
+            case GameCommand::vehicleClone:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     static uint32_t loc_4314EA();
     static uint32_t loc_4313C6(int esi, const registers& regs);
 
@@ -278,6 +341,23 @@ namespace OpenLoco::GameCommands
         int32_t ebx2 = fnRegs2.ebx;
         _gameCommandFlags = flagsBackup2;
 
+        if (commandModifiesOrders(GameCommand(esi)))
+        {
+            Vehicles::invalidateOrderCache();
+        }
+        if (GameCommand(esi) == GameCommand::createIndustry)
+        {
+            // New industries are placed with their fields
+            IndustryManager::invalidateFootprints();
+        }
+        if (!commandKeepsActiveObjects(GameCommand(esi)))
+        {
+            StationManager::invalidateActiveIds();
+            TownManager::invalidateActiveIds();
+            IndustryManager::invalidateActiveIds();
+            CompanyManager::invalidateActiveIds();
+        }
+
         if (ebx2 == static_cast<int32_t>(0x80000000))
         {
             return loc_4314EA();
@@ -1,4 +1,5 @@
 #include "Industry.h"
+#include "IndustryManager.h"
 #include "Interop/Interop.hpp"
 #include "Localisation/StringIds.h"
 #include "Map/TileManager.h"
@@ -7,6 +8,7 @@
 #include "Objects/ObjectManager.h"
 #include "Utility/Numeric.hpp"
 #include <algorithm>
+#include <cassert>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Map;
@@ -118,10 +120,27 @@ namespace OpenLoco
     {
         if (!(flags & IndustryFlags::flag_01) && under_construction == 0xFF)
         {
+            // Only tiles in the footprint can be tagged with this industry, skip checking the others
+            auto footprint = IndustryManager::getFootprint(id());
+            auto loopIndex = static_cast<uint32_t>((tile_loop.current().y / tile_size) * map_columns + tile_loop.current().x / tile_size);
+            auto nextFootprintTile = std::lower_bound(footprint.begin(), footprint.end(), loopIndex);
+
             // Run tile loop for 100 iterations
-            for (int i = 0; i < 100; i++)
+            for (int i = 0; i < 100; i++, loopIndex++)
             {
-                sub_45329B(tile_loop.current());
+                if (nextFootprintTile != footprint.end() && *nextFootprintTile == loopIndex)
+                {
+                    sub_45329B(tile_loop.current());
+                    nextFootprintTile++;
+                }
+#ifndef NDEBUG
+                else
+                {
+                    // A tile missing from the footprint would change var_DB and so the production
+                    auto surface = TileManager::get(tile_loop.current()).surface();
+                    assert(surface == nullptr || !surface->hasHighTypeFlag() || surface->industryId() != id());
+                }
+#endif
 
                 // loc_453318
                 if (tile_loop.next() == Pos2())
@@ -212,5 +231,9 @@ namespace OpenLoco
         regs.dl = dl;
         regs.dh = id();
         call(0x00454A43, regs);
+
+        // The extent of the new fields is decided by the original routine, they are picked up by
+        // the rescan at the start of the next tick
+        IndustryManager::invalidateFootprints();
     }
 }
@@ -1,18 +1,48 @@
 #include "IndustryManager.h"
 #include "CompanyManager.h"
 #include "Interop/Interop.hpp"
+#include "Localisation/StringIds.h"
+#include "Map/TileManager.h"
 #include "OpenLoco.h"
+#include <vector>
 
 using namespace OpenLoco::Interop;
+using namespace OpenLoco::Map;
 
 namespace OpenLoco::IndustryManager
 {
     static loco_global<Industry[max_industries], 0x005C455C> _industries;
+    static ActiveIdList<IndustryId_t, max_industries> _activeIds;
+
+    // Identifies which industry a footprint was built for, a mismatch means the slot has been reused
+    struct FootprintOwner
+    {
+        string_id name = StringIds::null;
+        coord_t x{};
+        coord_t y{};
+        uint8_t objectId{};
+
+        bool operator==(const FootprintOwner& rhs) const
+        {
+            return name == rhs.name && x == rhs.x && y == rhs.y && objectId == rhs.objectId;
+        }
+    };
+
+    // Surface tiles tagged with each industry (its farm fields) in tile loop order. Most tagging
+    // is still done by the original code, so this is invalidated after every original routine that
+    // can tag surfaces: planting fields (0x00454A43), the monthly update, creating an industry and
+    // loading. It is then rebuilt in a single map scan for all industries, at most once per tick at
+    // the start of the industry update. A reused industry slot is caught by the owner check.
+    // Tiles only need to be a superset, the industry still checks each surface.
+    static std::array<std::vector<uint32_t>, max_industries> _footprints;
+    static std::array<FootprintOwner, max_industries> _footprintOwners;
+    static bool _footprintsValid = false;
 
     // 0x00453214
     void reset()
     {
         call(0x00453214);
+        invalidateActiveIds();
     }
 
     std::array<Industry, max_industries>& industries()
@@ -30,18 +60,80 @@ namespace OpenLoco::IndustryManager
         return &_industries[id];
     }
 
+    // The industries that are in use, in id order
+    ActiveObjectRange<Industry, IndustryId_t> activeIndustries()
+    {
+        return ActiveObjectRange<Industry, IndustryId_t>(&_industries[0], _activeIds.get(&_industries[0]));
+    }
+
+    void invalidateActiveIds()
+    {
+        _activeIds.invalidate();
+    }
+
+    static FootprintOwner getFootprintOwner(const Industry& industry)
+    {
+        return { industry.name, industry.x, industry.y, industry.object_id };
+    }
+
+    static void rebuildFootprints()
+    {
+        for (auto& footprint : _footprints)
+        {
+            footprint.clear();
+        }
+
+        uint32_t index = 0;
+        for (tile_coord_t y = 0; y < map_rows; y++)
+        {
+            for (tile_coord_t x = 0; x < map_columns; x++, index++)
+            {
+                auto surface = TileManager::get(TilePos2(x, y)).surface();
+                if (surface != nullptr && surface->hasHighTypeFlag() && surface->industryId() < max_industries)
+                {
+                    _footprints[surface->industryId()].push_back(index);
+                }
+            }
+        }
+
+        for (auto& industry : industries())
+        {
+            _footprintOwners[industry.id()] = getFootprintOwner(industry);
+        }
+        _footprintsValid = true;
+    }
+
+    // Tile loop indices of the surfaces that may be tagged with the industry, in ascending order.
+    // Fields planted during this tick's industry update are only added on the next tick. They are
+    // tagged with the industry that planted them, which only does so once its tile loop has
+    // finished, so every other industry's footprint is still a superset.
+    stdx::span<const uint32_t> getFootprint(IndustryId_t id)
+    {
+        if (!(_footprintOwners[id] == getFootprintOwner(_industries[id])))
+        {
+            rebuildFootprints();
+        }
+        return _footprints[id];
+    }
+
+    void invalidateFootprints()
+    {
+        _footprintsValid = false;
+    }
+
     // 0x00453234
     void update()
     {
         if ((addr<0x00525E28, uint32_t>() & 1) && !isEditorMode())
         {
             CompanyManager::updatingCompanyId(CompanyId::neutral);
-            for (auto& industry : industries())
+            if (!_footprintsValid)
             {
-                if (!industry.empty())
-                {
-                    industry.update();
-                }
+                rebuildFootprints();
+            }
+            for (auto& industry : activeIndustries())
+            {
+                industry.update();
             }
         }
     }
@@ -50,6 +142,10 @@ namespace OpenLoco::IndustryManager
     void updateMonthly()
     {
         call(0x0045383B);
+
+        // Original monthly update may grow or add fields and open or close industries
+        invalidateFootprints();
+        invalidateActiveIds();
     }
 
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Core/ActiveIdList.hpp"
+#include "Core/Span.hpp"
 #include "Industry.h"
 #include <array>
 #include <cstddef>
@@ -11,6 +13,11 @@ namespace OpenLoco::IndustryManager
     void reset();
     std::array<Industry, max_industries>& industries();
     Industry* get(IndustryId_t id);
+    ActiveObjectRange<Industry, IndustryId_t> activeIndustries();
+    void invalidateActiveIds();
     void update();
     void updateMonthly();
+
+    stdx::span<const uint32_t> getFootprint(IndustryId_t id);
+    void invalidateFootprints();
 }
@@ -558,11 +558,8 @@ namespace OpenLoco::Input
                                                    firstTile.y,
                                                    building->baseZ() };
 
-                                for (auto& company : CompanyManager::companies())
+                                for (auto& company : CompanyManager::activeCompanies())
                                 {
-                                    if (company.empty())
-                                        continue;
-
                                     if (company.headquarters_x == pos.x
                                         && company.headquarters_y == pos.y
                                         && company.headquarters_z == pos.z)
@@ -802,7 +802,9 @@ void OpenLoco::Interop::registerHooks()
         0x004AB655,
         [](registers& regs) -> uint8_t {
             auto v = (Vehicles::VehicleBase*)regs.esi;
-            v->asVehicleBody()->secondaryAnimationUpdate();
+            Vehicles::UpdateContext ctx;
+            ctx.sync();
+            v->asVehicleBody()->secondaryAnimationUpdate(ctx);
 
             return 0;
         });
@@ -915,4 +917,25 @@ void OpenLoco::Interop::registerHooks()
             regs = backup;
             return 0;
         });
+
+    registerHook(
+        0x0046FC83,
+        [](registers& regs) -> uint8_t {
+            registers backup = regs;
+
+            auto* entity = reinterpret_cast<EntityBase*>(regs.esi);
+            entity->moveTo({ regs.ax, regs.cx, regs.dx });
+
+            regs = backup;
+            return 0;
+        });
+
+    registerHook(
+        0x0046FF54,
+        [](registers& regs) -> uint8_t {
+            registers backup = regs;
+            EntityManager::resetSpatialIndex();
+            regs = backup;
+            return 0;
+        });
 }
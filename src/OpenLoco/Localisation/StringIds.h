@@ -1601,4 +1601,22 @@ namespace OpenLoco::StringIds
     constexpr string_id cheat_ratings_plus_10pct = 2206;
     constexpr string_id cheat_ratings_to_min = 2207;
     constexpr string_id cheat_ratings_to_max = 2208;
+    constexpr string_id entity_pool_stats = 2209;
+    constexpr string_id entity_pool_stats_save_log = 2210;
+    constexpr string_id entity_pool_stats_list = 2211;
+    constexpr string_id entity_pool_stats_count = 2212;
+    constexpr string_id entity_pool_stats_low = 2213;
+    constexpr string_id entity_pool_stats_high = 2214;
+    constexpr string_id entity_pool_stats_allocations = 2215;
+    constexpr string_id entity_pool_stats_frees = 2216;
+    constexpr string_id entity_pool_stats_failures = 2217;
+    constexpr string_id entity_pool_stats_last_tick = 2218;
+    constexpr string_id entity_pool_stats_list_free = 2219;
+    constexpr string_id entity_pool_stats_list_free_money = 2220;
+    constexpr string_id entity_pool_stats_list_vehicle_heads = 2221;
+    constexpr string_id entity_pool_stats_list_vehicles = 2222;
+    constexpr string_id entity_pool_stats_list_misc = 2223;
+    constexpr string_id entity_pool_stats_count_value = 2224;
+    constexpr string_id entity_pool_stats_value = 2225;
+    constexpr string_id entity_pool_stats_last_tick_value = 2226;
 }
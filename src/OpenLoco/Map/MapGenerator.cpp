@@ -1,7 +1,11 @@
 #include "MapGenerator.h"
+#include "../CompanyManager.h"
+#include "../IndustryManager.h"
 #include "../Interop/Interop.hpp"
 #include "../S5/S5.h"
 #include "../Scenario.h"
+#include "../StationManager.h"
+#include "../TownManager.h"
 #include "../Ui/ProgressBar.h"
 #include "../Ui/WindowManager.h"
 #include "Tile.h"
@@ -532,6 +536,11 @@ namespace OpenLoco::Map::MapGenerator
 
         call(0x004969E0);
         call(0x004748D4);
+        TileManager::endDefragment();
+        StationManager::invalidateActiveIds();
+        TownManager::invalidateActiveIds();
+        IndustryManager::invalidateActiveIds();
+        CompanyManager::invalidateActiveIds();
         Ui::ProgressBar::end();
     }
 }
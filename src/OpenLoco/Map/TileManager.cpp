@@ -3,6 +3,11 @@
 #include "../Interop/Interop.hpp"
 #include "../Map/Map.hpp"
 #include "../ViewportManager.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -28,6 +33,7 @@ namespace OpenLoco::Map::TileManager
     void initialise()
     {
         call(0x00461179);
+        endDefragment();
     }
 
     stdx::span<TileElement> getElements()
@@ -260,7 +266,7 @@ namespace OpenLoco::Map::TileManager
         {
             // Allocate a temporary buffer and tighly pack all the tile elements in the map
             std::vector<TileElement> tempBuffer;
-            tempBuffer.resize(maxElements * sizeof(TileElement));
+            tempBuffer.resize(maxElements);
 
             size_t numElements = 0;
             for (tile_coord_t y = 0; y < map_rows; y++)
@@ -284,6 +290,7 @@ namespace OpenLoco::Map::TileManager
             std::memset(_elements + numElements, 0, remainingElements * sizeof(TileElement));
 
             updateTilePointers();
+            endDefragment();
 
             // Note: original implementation did not revert the cursor
             Ui::setCursor(Ui::CursorId::pointer);
@@ -295,6 +302,216 @@ namespace OpenLoco::Map::TileManager
         }
     }
 
+    ElementStats getElementStats()
+    {
+        ElementStats stats{};
+        stats.capacity = maxElements;
+        stats.allocated = _elementsEnd - _elements;
+        for (tile_coord_t y = 0; y < map_rows; y++)
+        {
+            for (tile_coord_t x = 0; x < map_columns; x++)
+            {
+                auto tile = get(TilePos2(x, y));
+                if (!tile.isNull())
+                {
+                    stats.used += tile.size();
+                }
+            }
+        }
+        stats.unused = stats.allocated - std::min(stats.used, stats.allocated);
+        return stats;
+    }
+
+    // The original element removal (0x00461760) and the tile list move in element insertion
+    // (0x00461578) set the base height of the elements they free to this. Debug builds check this
+    // against the element count whenever a pass starts.
+    constexpr uint8_t freeElementBaseZ = 0xFF;
+    constexpr uint32_t nullOwner = std::numeric_limits<uint32_t>::max();
+    // Defragment once this many elements are unused
+    constexpr size_t defragmentThreshold = maxElements / 64;
+    // Number of elements examined per tick while defragmenting
+    constexpr size_t defragmentBudget = 4096;
+    constexpr uint32_t defragmentCheckInterval = 128;
+    // Rows counted per tick, so the used element count is refreshed once per check interval
+    constexpr tile_coord_t defragmentCountRows = (map_rows + defragmentCheckInterval - 1) / defragmentCheckInterval;
+
+    // Incremental replacement for reorganise, slides tile element lists down over free elements a
+    // few at a time. Lists are not put into tile order, only packed.
+    struct DefragmentState
+    {
+        bool active = false;
+        bool ownersRebuilt = false;
+        tile_coord_t countRow = 0;    // Next row to count the used elements of
+        size_t countUsed = 0;         // Used elements in the rows counted so far
+        TileElement* write = nullptr; // Elements before this are packed
+        TileElement* read = nullptr;  // Next element to examine, everything from write to here is free
+        std::vector<uint32_t> owners; // Tile index of the list starting at each element
+    };
+    static DefragmentState _defragment;
+
+    static bool isFree(const TileElement& element)
+    {
+        return static_cast<const TileElementBase&>(element).baseZ() == freeElementBaseZ;
+    }
+
+    static void markFree(TileElement& element)
+    {
+        element.rawData()[2] = freeElementBaseZ;
+    }
+
+    static void buildDefragmentOwners()
+    {
+        _defragment.owners.assign(maxElements, nullOwner);
+        for (tile_coord_t y = 0; y < map_rows; y++)
+        {
+            for (tile_coord_t x = 0; x < map_columns; x++)
+            {
+                auto index = (y * map_pitch) + x;
+                auto el = _tiles[index];
+                if (el != InvalidTile && el != nullptr)
+                {
+                    _defragment.owners[el - _elements] = index;
+                }
+            }
+        }
+    }
+
+    // Abandons any pass in progress, e.g. when the element pool has been replaced or reorganised
+    void endDefragment()
+    {
+        _defragment.active = false;
+        _defragment.countRow = 0;
+        _defragment.countUsed = 0;
+        _defragment.owners.clear();
+        _defragment.owners.shrink_to_fit();
+    }
+
+    static void finishDefragment()
+    {
+        TileElement* end = _elementsEnd;
+        if (_defragment.write <= end && std::all_of(_defragment.write, end, isFree))
+        {
+            _elementsEnd = _defragment.write;
+        }
+        endDefragment();
+    }
+
+    // Moves up to defragmentBudget elements towards the start of the pool, starting a new pass once
+    // enough elements are unused. Must only be called between game ticks.
+    void defragmentStep()
+    {
+        if (_elements == nullptr)
+            return;
+
+        if (!_defragment.active)
+        {
+            // The used count is spread over several ticks rather than walking the whole map at once.
+            // Tiles may change in the meantime, the count only decides when to start a pass.
+            auto lastRow = std::min<tile_coord_t>(_defragment.countRow + defragmentCountRows, map_rows);
+            for (auto y = _defragment.countRow; y < lastRow; y++)
+            {
+                for (tile_coord_t x = 0; x < map_columns; x++)
+                {
+                    auto tile = get(TilePos2(x, y));
+                    if (!tile.isNull())
+                    {
+                        _defragment.countUsed += tile.size();
+                    }
+                }
+            }
+            _defragment.countRow = lastRow;
+            if (_defragment.countRow < map_rows)
+                return;
+
+            size_t allocated = _elementsEnd - _elements;
+            auto unused = allocated - std::min(_defragment.countUsed, allocated);
+            _defragment.countRow = 0;
+            _defragment.countUsed = 0;
+            if (unused < defragmentThreshold)
+                return;
+
+#ifndef NDEBUG
+            // Every element outside of a tile's list should carry the free marker
+            auto stats = getElementStats();
+            TileElement* begin = _elements;
+            auto numMarkedFree = static_cast<size_t>(std::count_if(begin, getElementsEnd(), isFree));
+            assert(numMarkedFree == stats.unused);
+#endif
+
+            _defragment.active = true;
+            _defragment.ownersRebuilt = false;
+            _defragment.write = _elements;
+            _defragment.read = _elements;
+            buildDefragmentOwners();
+        }
+
+        size_t work = 0;
+        while (work < defragmentBudget)
+        {
+            auto& read = _defragment.read;
+            auto& write = _defragment.write;
+            TileElement* end = _elementsEnd;
+            if (read >= end)
+            {
+                finishDefragment();
+                return;
+            }
+
+            if (isFree(*read))
+            {
+                read++;
+                work++;
+                continue;
+            }
+
+            // Lists may have been moved or added by the original code since the owners were found
+            auto owner = _defragment.owners[read - _elements];
+            if (owner == nullOwner || _tiles[owner] != read)
+            {
+                if (_defragment.ownersRebuilt)
+                {
+                    // Not the start of any tile's list, the pool is not laid out as expected
+                    endDefragment();
+                    return;
+                }
+                buildDefragmentOwners();
+                _defragment.ownersRebuilt = true;
+                continue;
+            }
+            _defragment.ownersRebuilt = false;
+
+            auto last = read;
+            while (!last->isLast() && last + 1 < end)
+            {
+                last++;
+            }
+            auto size = static_cast<size_t>(last - read) + 1;
+
+            if (read != write)
+            {
+                auto gap = std::min<size_t>(size, read - write);
+                if (!std::all_of(write, write + gap, isFree))
+                {
+                    endDefragment();
+                    return;
+                }
+
+                std::memmove(write, read, size * sizeof(TileElement));
+                _tiles[owner] = write;
+
+                // Vacated elements still look like a live copy of the list
+                for (auto el = std::max(write + size, read); el < read + size; el++)
+                {
+                    markFree(*el);
+                }
+            }
+
+            write += size;
+            read += size;
+            work += size;
+        }
+    }
+
     // 0x0045F1A7
     Pos2 screenGetMapXY(int16_t x, int16_t y)
     {
@@ -482,4 +699,5 @@ namespace OpenLoco::Map::TileManager
             mapInvalidateTileFull(position);
         }
     }
+
 }
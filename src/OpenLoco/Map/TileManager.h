@@ -15,6 +15,14 @@ namespace OpenLoco::Map::TileManager
 
     constexpr size_t maxElements = 0x6C000;
 
+    struct ElementStats
+    {
+        size_t capacity;  // Size of the element pool
+        size_t allocated; // Elements up to the end of the last tile
+        size_t used;      // Elements belonging to a tile
+        size_t unused;    // Free elements left behind by moved or shrunk tiles
+    };
+
     void initialise();
     stdx::span<TileElement> getElements();
     TileElement* getElementsEnd();
@@ -25,6 +33,9 @@ namespace OpenLoco::Map::TileManager
     TileHeight getHeight(const Pos2& pos);
     void updateTilePointers();
     void reorganise();
+    void defragmentStep();
+    void endDefragment();
+    ElementStats getElementStats();
     Pos2 screenGetMapXY(int16_t x, int16_t y);
     uint16_t setMapSelectionTiles(int16_t x, int16_t y);
     Pos3 screenPosToMapPos(int16_t x, int16_t y);
@@ -0,0 +1,58 @@
+#include "MonthlyScheduler.h"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace OpenLoco::MonthlyScheduler
+{
+    // Pending slices run in the order they were enqueued at a fixed rate per tick, so every client
+    // runs each slice on the same tick
+    static constexpr size_t slicesPerTick = 8;
+
+    static std::vector<Slice> _slices;
+    static size_t _nextSlice = 0;
+
+    void enqueue(Slice&& slice)
+    {
+        _slices.push_back(std::move(slice));
+    }
+
+    static void runSlices(size_t count)
+    {
+        for (; count != 0 && _nextSlice < _slices.size(); count--)
+        {
+            // Take the slice out first, it may enqueue further slices
+            auto slice = std::move(_slices[_nextSlice++]);
+            slice();
+        }
+
+        if (_nextSlice == _slices.size())
+        {
+            _slices.clear();
+            _nextSlice = 0;
+        }
+    }
+
+    // Runs the next slices, called once per game tick
+    void update()
+    {
+        runSlices(slicesPerTick);
+    }
+
+    // Runs every pending slice, used before anything that needs the complete month end state
+    // such as saving or starting the next month end
+    void flush()
+    {
+        while (!_slices.empty())
+        {
+            runSlices(_slices.size() - _nextSlice);
+        }
+    }
+
+    // Drops pending slices without running them, the state they were for has been replaced
+    void reset()
+    {
+        _slices.clear();
+        _nextSlice = 0;
+    }
+}
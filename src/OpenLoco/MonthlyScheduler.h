@@ -0,0 +1,16 @@
+#pragma once
+
+#include <functional>
+
+namespace OpenLoco::MonthlyScheduler
+{
+    // A piece of month end work for a single object. Slices must only touch state that nothing
+    // else reads or writes until the slice has run, anything they need from the month end must
+    // be captured when they are enqueued.
+    using Slice = std::function<void()>;
+
+    void enqueue(Slice&& slice);
+    void update();
+    void flush();
+    void reset();
+}
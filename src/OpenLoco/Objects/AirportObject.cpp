@@ -2,9 +2,144 @@
 #include "../Graphics/Colour.h"
 #include "../Graphics/Gfx.h"
 #include "ObjectManager.h"
+#include <array>
+#include <vector>
 
 namespace OpenLoco
 {
+    namespace
+    {
+        // Adjacency tables built from the movement edges of one loaded airport object
+        struct MovementGraph
+        {
+            const AirportObject* object = nullptr;
+            const AirportObject::MovementEdge* edges = nullptr;
+            const AirportObject::MovementNode* nodes = nullptr;
+            uint8_t numEdges = 0;
+            uint8_t numNodes = 0;
+
+            std::vector<AirportObject::MovementEdgeRequirement> entryEdges;
+            // Outgoing edges grouped by their current node; offsets has numNodes + 1 entries
+            std::vector<AirportObject::MovementEdgeRequirement> planeEdges;
+            std::vector<AirportObject::MovementEdgeRequirement> helicopterEdges;
+            std::vector<uint16_t> planeOffsets;
+            std::vector<uint16_t> helicopterOffsets;
+
+            bool isFor(const AirportObject& airport) const
+            {
+                return object == &airport && edges == airport.movementEdges && nodes == airport.movementNodes && numEdges == airport.numMovementEdges && numNodes == airport.numMovementNodes;
+            }
+        };
+
+        // Indexed by airport object slot. Built when the objects are reloaded and freed when one is
+        // unloaded. Some objects are still loaded by original code without passing through either, so
+        // a graph that does not match the object in its slot is rebuilt on lookup.
+        static std::array<MovementGraph, ObjectManager::getMaxObjects(object_type::airport)> _movementGraphs;
+
+        static AirportObject::MovementEdgeRequirement makeRequirement(const AirportObject::MovementEdge& edge, const uint8_t edgeId)
+        {
+            return { edgeId, edge.mustBeClearEdges, edge.atLeastOneClearEdges };
+        }
+
+        static void buildAdjacency(const AirportObject& airport, const uint16_t excludedFlags, std::vector<AirportObject::MovementEdgeRequirement>& edges, std::vector<uint16_t>& offsets)
+        {
+            edges.clear();
+            offsets.assign(airport.numMovementNodes + 1, 0);
+
+            // Counting sort on curNode keeps the original edge order within each node
+            for (uint8_t i = 0; i < airport.numMovementEdges; i++)
+            {
+                const auto& edge = airport.movementEdges[i];
+                if (edge.curNode >= airport.numMovementNodes || (airport.movementNodes[edge.nextNode].flags & excludedFlags))
+                    continue;
+                offsets[edge.curNode + 1]++;
+            }
+            for (size_t node = 1; node < offsets.size(); node++)
+            {
+                offsets[node] += offsets[node - 1];
+            }
+
+            edges.resize(offsets.back());
+            auto insertPos = offsets;
+            for (uint8_t i = 0; i < airport.numMovementEdges; i++)
+            {
+                const auto& edge = airport.movementEdges[i];
+                if (edge.curNode >= airport.numMovementNodes || (airport.movementNodes[edge.nextNode].flags & excludedFlags))
+                    continue;
+                edges[insertPos[edge.curNode]++] = makeRequirement(edge, i);
+            }
+        }
+
+        static void buildGraph(MovementGraph& graph, const AirportObject& airport)
+        {
+            graph.object = &airport;
+            graph.edges = airport.movementEdges;
+            graph.nodes = airport.movementNodes;
+            graph.numEdges = airport.numMovementEdges;
+            graph.numNodes = airport.numMovementNodes;
+
+            graph.entryEdges.clear();
+            for (uint8_t i = 0; i < airport.numMovementEdges; i++)
+            {
+                const auto& edge = airport.movementEdges[i];
+                if (airport.movementNodes[edge.curNode].flags & AirportMovementNodeFlags::flag2)
+                {
+                    graph.entryEdges.push_back(makeRequirement(edge, i));
+                }
+            }
+
+            // Planes never use the helicopter take off and helicopters never use the runway
+            buildAdjacency(airport, AirportMovementNodeFlags::heliTakeoffBegin, graph.planeEdges, graph.planeOffsets);
+            buildAdjacency(airport, AirportMovementNodeFlags::takeoffBegin, graph.helicopterEdges, graph.helicopterOffsets);
+        }
+
+        static const MovementGraph& getMovementGraph(const uint8_t objectId)
+        {
+            auto& graph = _movementGraphs[objectId];
+            const auto* airport = ObjectManager::get<AirportObject>(objectId);
+            if (!graph.isFor(*airport))
+            {
+                buildGraph(graph, *airport);
+            }
+            return graph;
+        }
+    }
+
+    void AirportObject::loadMovementGraph(const uint8_t objectId)
+    {
+        const auto* airport = ObjectManager::get<AirportObject>(objectId);
+        if (airport == nullptr)
+        {
+            unloadMovementGraph(objectId);
+            return;
+        }
+        buildGraph(_movementGraphs[objectId], *airport);
+    }
+
+    void AirportObject::unloadMovementGraph(const uint8_t objectId)
+    {
+        _movementGraphs[objectId] = MovementGraph();
+    }
+
+    stdx::span<const AirportObject::MovementEdgeRequirement> AirportObject::getEntryEdges(const uint8_t objectId)
+    {
+        const auto& graph = getMovementGraph(objectId);
+        return stdx::span<const MovementEdgeRequirement>(graph.entryEdges.data(), graph.entryEdges.size());
+    }
+
+    stdx::span<const AirportObject::MovementEdgeRequirement> AirportObject::getOutgoingEdges(const uint8_t objectId, const uint8_t node, const bool isHelicopter)
+    {
+        const auto& graph = getMovementGraph(objectId);
+        if (node >= graph.numNodes)
+        {
+            return {};
+        }
+
+        const auto& edges = isHelicopter ? graph.helicopterEdges : graph.planeEdges;
+        const auto& offsets = isHelicopter ? graph.helicopterOffsets : graph.planeOffsets;
+        return stdx::span<const MovementEdgeRequirement>(edges.data() + offsets[node], offsets[node + 1] - offsets[node]);
+    }
+
     // 0x00490DCF
     void AirportObject::drawPreviewImage(Gfx::drawpixelinfo_t& dpi, const int16_t x, const int16_t y) const
     {
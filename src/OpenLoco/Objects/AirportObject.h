@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../Core/Span.hpp"
 #include "../Types.hpp"
 
 namespace OpenLoco
@@ -43,6 +44,23 @@ namespace OpenLoco
             uint32_t atLeastOneClearEdges; // 0x08 Which edges must have at least one clear to use transition edge
         };
 
+        // A movement edge together with the occupancy it requires, as stored in the adjacency tables
+        struct MovementEdgeRequirement
+        {
+            uint8_t edge;
+            uint32_t mustBeClearEdges;
+            uint32_t atLeastOneClearEdges;
+
+            bool canUse(const uint32_t occupiedEdges) const
+            {
+                if (occupiedEdges & mustBeClearEdges)
+                {
+                    return false;
+                }
+                return atLeastOneClearEdges == 0 || (occupiedEdges & atLeastOneClearEdges) != atLeastOneClearEdges;
+            }
+        };
+
         string_id name;
         uint16_t build_cost_factor; // 0x02
         uint16_t sell_cost_factor;  // 0x04
@@ -67,6 +85,14 @@ namespace OpenLoco
         MovementEdge* movementEdges; // 0xB2
         uint8_t pad_B6[0xBA - 0xB6];
 
+        // Builds the movement graph of the airport object in the slot, or frees it if the slot is empty
+        static void loadMovementGraph(const uint8_t objectId);
+        static void unloadMovementGraph(const uint8_t objectId);
+        // Edges that start at a node aircraft may enter the airport from (flag2), in edge order
+        static stdx::span<const MovementEdgeRequirement> getEntryEdges(const uint8_t objectId);
+        // Edges leaving the node in edge order, excluding those leading to the take off of the other aircraft kind
+        static stdx::span<const MovementEdgeRequirement> getOutgoingEdges(const uint8_t objectId, const uint8_t node, const bool isHelicopter);
+
         void drawPreviewImage(Gfx::drawpixelinfo_t& dpi, const int16_t x, const int16_t y) const;
         void drawDescription(Gfx::drawpixelinfo_t& dpi, const int16_t x, const int16_t y, [[maybe_unused]] const int16_t width) const;
     };
@@ -1,4 +1,5 @@
 #include "ObjectManager.h"
+#include "AirportObject.h"
 #include "../Graphics/Colour.h"
 #include "../Graphics/Gfx.h"
 #include "../Interop/Interop.hpp"
@@ -461,6 +462,11 @@ namespace OpenLoco::ObjectManager
     void reloadAll()
     {
         call(0x0047237D);
+
+        for (size_t i = 0; i < getMaxObjects(object_type::airport); i++)
+        {
+            AirportObject::loadMovementGraph(static_cast<uint8_t>(i));
+        }
     }
 
     enum class ObjectProcedure
@@ -494,6 +500,11 @@ namespace OpenLoco::ObjectManager
 
     void unload(LoadedObjectIndex index)
     {
+        auto objectHeader = getHeader(index);
+        if (objectHeader != nullptr && objectHeader->getType() == object_type::airport)
+        {
+            AirportObject::unloadMovementGraph(static_cast<uint8_t>(index - getLoadedObjectIndex(object_type::airport, 0)));
+        }
         callObjectFunction(index, ObjectProcedure::unload);
     }
 
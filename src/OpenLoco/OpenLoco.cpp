@@ -30,6 +30,7 @@
 #include "EditorController.h"
 #include "Entities/EntityManager.h"
 #include "Entities/EntityTweener.h"
+#include "Entities/Misc.h"
 #include "Environment.h"
 #include "Game.h"
 #include "GameException.hpp"
@@ -43,6 +44,8 @@
 #include "Localisation/LanguageFiles.h"
 #include "Localisation/Languages.h"
 #include "Localisation/StringIds.h"
+#include "Map/TileManager.h"
+#include "MonthlyScheduler.h"
 #include "MultiPlayer.h"
 #include "Objects/ObjectManager.h"
 #include "OpenLoco.h"
@@ -58,6 +61,8 @@
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
 #include "Utility/Numeric.hpp"
+#include "Utility/String.hpp"
+#include "Vehicles/Orders.h"
 #include "ViewportManager.h"
 
 #pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non - portable
@@ -344,6 +349,7 @@ namespace OpenLoco
     // 0x004BE65E
     [[noreturn]] void exitCleanly()
     {
+        S5::waitForAsyncSave();
         Audio::close();
 
         auto tempFilePath = Environment::getPathNoWarning(Environment::path_id::_1tmp);
@@ -398,11 +404,61 @@ namespace OpenLoco
         // TODO Move this to a more generic, initialise game state function when
         //      we have one hooked / implemented.
         autosaveReset();
+        S5::resetDeltaChain();
+        Map::TileManager::endDefragment();
+        IndustryManager::invalidateFootprints();
+        Vehicles::invalidateOrderCache();
+        StationManager::invalidateActiveIds();
+        TownManager::invalidateActiveIds();
+        IndustryManager::invalidateActiveIds();
+        CompanyManager::invalidateActiveIds();
+        CompanyManager::rebuildTransportCounts();
+        MonthlyScheduler::reset();
+        EntityManager::resetPoolStats();
+        resetParticleLimit();
+    }
+
+    // The original loader does not understand delta autosaves, a delta passed on the command line is
+    // rebuilt into a full save first.
+    static void rebuildCommandLineDelta()
+    {
+        const char* cmdLine = glpCmdLine;
+        if (cmdLine == nullptr)
+            return;
+
+        std::string arg = cmdLine;
+        arg.erase(std::remove(arg.begin(), arg.end(), '"'), arg.end());
+        auto first = arg.find_first_not_of(" \t");
+        auto last = arg.find_last_not_of(" \t");
+        if (first == std::string::npos)
+            return;
+        arg = arg.substr(first, last - first + 1);
+
+        if (!Utility::endsWith(arg, S5::extensionSV5, true))
+            return;
+
+        auto path = fs::u8path(arg);
+        if (!S5::isDeltaFile(path))
+            return;
+
+        static std::string rebuiltCmdLine;
+        auto rebuiltPath = path.parent_path() / "rebuilt_autosave.SV5";
+        if (S5::rebuildFromDeltaChain(path, rebuiltPath))
+        {
+            rebuiltCmdLine = rebuiltPath.u8string();
+        }
+        else
+        {
+            std::fprintf(stderr, "Unable to load delta autosave: %s\n", arg.c_str());
+            rebuiltCmdLine.clear();
+        }
+        glpCmdLine = rebuiltCmdLine.data();
     }
 
     static void initialise()
     {
         std::srand(std::time(0));
+        rebuildCommandLineDelta();
         addr<0x0050C18C, int32_t>() = addr<0x00525348, int32_t>();
         call(0x004078BE);
         call(0x004BF476);
@@ -672,6 +728,8 @@ namespace OpenLoco
 
                 Input::handleKeyboard();
                 Audio::updateSounds();
+                S5::updateAsyncSave();
+                Map::TileManager::defragmentStep();
 
                 addr<0x0050C1AE, int32_t>()++;
                 if (Intro::isActive())
@@ -827,6 +885,7 @@ namespace OpenLoco
         addr<0x00525FD0, uint32_t>() = _prng->srand_1();
         call(0x004613F0);
         addr<0x00F25374, uint8_t>() = S5::getOptions().madeAnyChanges;
+        MonthlyScheduler::update();
         dateTick();
         call(0x00463ABA);
         call(0x004C56F6);
@@ -842,6 +901,7 @@ namespace OpenLoco
         Audio::updateVehicleNoise();
         Audio::updateAmbientNoise();
         Title::update();
+        EntityManager::updatePoolStats();
 
         S5::getOptions().madeAnyChanges = addr<0x00F25374, uint8_t>();
         if (_50C197 != 0)
@@ -892,8 +952,12 @@ namespace OpenLoco
                     // Sort them by name (which should correspond to date order)
                     std::sort(autosaveFiles.begin(), autosaveFiles.end());
 
-                    // Delete excess files
+                    // Delete excess files, but keep every file back to the base of the oldest kept delta
                     auto numToDelete = autosaveFiles.size() - amountToKeep;
+                    while (numToDelete > 0 && S5::isDeltaFile(autosaveFiles[numToDelete]))
+                    {
+                        numToDelete--;
+                    }
                     for (size_t i = 0; i < numToDelete; i++)
                     {
                         auto path8 = autosaveFiles[i].u8string();
@@ -936,7 +1000,25 @@ namespace OpenLoco
 
             auto autosaveFullPath8 = autosaveFullPath.u8string();
             std::printf("Autosaving game to %s\n", autosaveFullPath8.c_str());
-            S5::save(autosaveFullPath, static_cast<S5::SaveFlags>(S5::SaveFlags::noWindowClose));
+            uint32_t flags = S5::SaveFlags::noWindowClose;
+            if (Config::getNew().autosave_delta)
+            {
+                flags |= S5::SaveFlags::delta;
+            }
+            if (Config::getNew().autosave_background)
+            {
+                S5::saveAsync(autosaveFullPath, static_cast<S5::SaveFlags>(flags), [](const fs::path&, bool success, const std::string&) {
+                    if (success)
+                    {
+                        autosaveClean();
+                    }
+                });
+            }
+            else
+            {
+                S5::save(autosaveFullPath, static_cast<S5::SaveFlags>(flags));
+                autosaveClean();
+            }
         }
         catch (const std::exception& e)
         {
@@ -951,10 +1033,9 @@ namespace OpenLoco
         if (!isTitleMode())
         {
             auto freq = Config::getNew().autosave_frequency;
-            if (freq > 0 && _monthsSinceLastAutosave >= freq)
+            if (freq > 0 && _monthsSinceLastAutosave >= freq && !S5::isAsyncSaveInProgress())
             {
                 autosave();
-                autosaveClean();
             }
         }
     }
@@ -982,8 +1063,9 @@ namespace OpenLoco
                     // End of every month
                     Ui::Windows::TimePanel::invalidateFrame();
                     addr<0x00526243, uint16_t>()++;
+                    MonthlyScheduler::flush();
                     TownManager::updateMonthly();
-                    call(0x0045383B);
+                    IndustryManager::updateMonthly();
                     call(0x0043037B);
                     call(0x0042F213);
                     call(0x004C3C54);
@@ -1017,6 +1099,12 @@ namespace OpenLoco
                 }
 
                 call(0x00437FB8);
+
+                // The original daily, monthly and yearly updates open and close industries and
+                // wind up companies
+                StationManager::invalidateActiveIds();
+                IndustryManager::invalidateActiveIds();
+                CompanyManager::invalidateActiveIds();
             }
         }
     }
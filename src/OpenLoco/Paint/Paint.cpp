@@ -586,13 +586,8 @@ namespace OpenLoco::Paint
 
         auto rect = (*_dpi)->getDrawableRect();
 
-        for (auto& station : StationManager::stations())
+        for (auto& station : StationManager::activeStations())
         {
-            if (station.empty())
-            {
-                continue;
-            }
-
             if (station.flags & StationFlags::flag_5)
             {
                 continue;
@@ -623,13 +618,8 @@ namespace OpenLoco::Paint
 
         auto rect = (*_dpi)->getDrawableRect();
 
-        for (auto& town : TownManager::towns())
+        for (auto& town : TownManager::activeTowns())
         {
-            if (town.empty())
-            {
-                continue;
-            }
-
             if (!town.labelFrame.contains(rect, (*_dpi)->zoom_level))
             {
                 continue;
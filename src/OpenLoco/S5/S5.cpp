@@ -1,8 +1,10 @@
 #include "S5.h"
 #include "../CompanyManager.h"
+#include "../Core/Optional.hpp"
 #include "../Entities/EntityManager.h"
 #include "../Interop/Interop.hpp"
 #include "../Map/TileManager.h"
+#include "../MonthlyScheduler.h"
 #include "../Objects/ObjectManager.h"
 #include "../StationManager.h"
 #include "../Ui/WindowManager.h"
@@ -10,7 +12,10 @@
 #include "../Vehicles/Orders.h"
 #include "../ViewportManager.h"
 #include "SawyerStream.h"
+#include <chrono>
 #include <fstream>
+#include <future>
+#include <mutex>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Map;
@@ -27,7 +32,61 @@ namespace OpenLoco::S5
     static loco_global<Options, 0x009CCA54> _previewOptions;
     static loco_global<char[512], 0x0112CE04> _savePath;
 
-    static bool save(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects);
+    struct AsyncSave
+    {
+        fs::path path;
+        SaveFlags flags;
+        SaveCompleteCallback onComplete;
+        std::future<std::string> error;
+    };
+
+    static std::optional<AsyncSave> _asyncSave;
+
+    constexpr uint32_t deltaMagicNumber = 0x544C4544; // DELT
+    constexpr uint32_t deltaVersion = 1;
+    constexpr uint32_t deltaPageSize = 4096;
+    constexpr uint32_t maxDeltaChainLength = 16;
+
+#pragma pack(push, 1)
+    struct DeltaHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t sequence; // 1 for the first delta after the base file
+        char previousFile[256];
+        uint32_t pageSize;
+        uint32_t gameStateSize;
+        uint32_t tileElementsSize;
+        uint32_t numPages;
+    };
+#pragma pack(pop)
+
+    // The last file written with SaveFlags::delta and its contents, which the pages of the next
+    // delta are compared against
+    struct DeltaChain
+    {
+        fs::path lastPath;
+        uint32_t length{};
+        std::vector<uint8_t> gameState;
+        std::vector<uint8_t> tileElements;
+    };
+
+    // Delta saves are written on the background save thread while a game may be loaded on the main
+    // thread. Loading bumps the generation, saves of a snapshot taken before that neither use nor
+    // update the chain.
+    static std::mutex _deltaChainMutex;
+    static DeltaChain _deltaChain;
+    static uint32_t _deltaChainGeneration;
+
+    static uint32_t getDeltaChainGeneration()
+    {
+        std::lock_guard<std::mutex> lock(_deltaChainMutex);
+        return _deltaChainGeneration;
+    }
+
+    static bool save(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags);
+    static void writeSave(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags, uint32_t deltaGeneration);
+    static void writeFile(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects);
 
     Options& getOptions()
     {
@@ -194,35 +253,46 @@ namespace OpenLoco::S5
     }
 
     /**
-     * Removes all tile elements that have the ghost flag set.
-     * Assumes all elements are organised in tile order.
+     * Copies the elements of every tile in tile order in a single pass, leaving out ghost elements.
+     * A ghost is only kept when it is the sole element of its tile as every tile needs an element.
      */
-    static void removeGhostElements(std::vector<TileElement>& elements)
+    static std::vector<TileElement> packTileElements()
     {
-        for (size_t i = 0; i < elements.size(); i++)
+        static_assert(sizeof(TileElement) == sizeof(Map::TileElement));
+
+        // All live elements are within the element buffer so its size is an upper bound
+        std::vector<TileElement> result(TileManager::getElements().size());
+        auto dst = result.data();
+        for (tile_coord_t y = 0; y < map_rows; y++)
         {
-            if (elements[i].isGhost())
+            for (tile_coord_t x = 0; x < map_columns; x++)
             {
-                if (elements[i].isLast())
+                auto tile = TileManager::get(TilePos2(x, y));
+                if (tile.isNull())
                 {
-                    if (i == 0 || elements[i - 1].isLast())
-                    {
-                        // First element of tile, can not remove...
-                    }
-                    else
+                    throw std::runtime_error("Tile has no elements");
+                }
+
+                auto tileStart = dst;
+                for (const auto& element : tile)
+                {
+                    if (!element.isGhost())
                     {
-                        elements[i - 1].setLast(true);
-                        elements.erase(elements.begin() + i);
-                        i--;
+                        std::memcpy(dst, &element, sizeof(TileElement));
+                        dst->setLast(false);
+                        dst++;
                     }
                 }
-                else
+                if (dst == tileStart)
                 {
-                    elements.erase(elements.begin() + i);
-                    i--;
+                    std::memcpy(dst, tile.end() - 1, sizeof(TileElement));
+                    dst++;
                 }
+                (dst - 1)->setLast(true);
             }
         }
+        result.resize(dst - result.data());
+        return result;
     }
 
     static std::unique_ptr<S5File> prepareSaveFile(SaveFlags flags, const std::vector<ObjectHeader>& requiredObjects, const std::vector<ObjectHeader>& packedObjects)
@@ -248,10 +318,7 @@ namespace OpenLoco::S5
         file->gameState.savedViewRotation = savedView.rotation;
         file->gameState.magicNumber = magicNumber; // Match implementation at 0x004437FC
 
-        auto tileElements = TileManager::getElements();
-        file->tileElements.resize(tileElements.size());
-        std::memcpy(file->tileElements.data(), tileElements.data(), tileElements.size_bytes());
-        removeGhostElements(file->tileElements);
+        file->tileElements = packTileElements();
         return file;
     }
 
@@ -260,22 +327,39 @@ namespace OpenLoco::S5
         return !(flags & SaveFlags::raw) && !(flags & SaveFlags::dump) && (flags & SaveFlags::packCustomObjects) && !isNetworked();
     }
 
-    // 0x00441C26
-    bool save(const fs::path& path, SaveFlags flags)
+    static void beginSave(SaveFlags flags)
     {
         if (!(flags & SaveFlags::noWindowClose) && !(flags & SaveFlags::raw) && !(flags & SaveFlags::dump))
         {
             WindowManager::closeConstructionWindows();
         }
 
+        // Saves have to contain the same state as if the month end had run in one go
+        MonthlyScheduler::flush();
+
+        // Tile elements are packed in tile order when copied, see packTileElements
         if (!(flags & SaveFlags::raw))
         {
-            TileManager::reorganise();
             EntityManager::resetSpatialIndex();
             EntityManager::zeroUnused();
             StationManager::zeroUnused();
             Vehicles::zeroOrderTable();
         }
+    }
+
+    static void onSaveComplete(SaveFlags flags)
+    {
+        Gfx::invalidateScreen();
+        if (!(flags & SaveFlags::raw))
+        {
+            resetScreenAge();
+        }
+    }
+
+    // 0x00441C26
+    bool save(const fs::path& path, SaveFlags flags)
+    {
+        beginSave(flags);
 
         bool saveResult;
         {
@@ -289,7 +373,7 @@ namespace OpenLoco::S5
             }
 
             auto file = prepareSaveFile(flags, requiredObjects, packedObjects);
-            saveResult = save(path, *file, packedObjects);
+            saveResult = save(path, *file, packedObjects, flags);
         }
 
         if (!(flags & SaveFlags::raw) && !(flags & SaveFlags::dump))
@@ -299,65 +383,432 @@ namespace OpenLoco::S5
 
         if (saveResult)
         {
-            Gfx::invalidateScreen();
-            if (!(flags & SaveFlags::raw))
-            {
-                resetScreenAge();
-            }
-
+            onSaveComplete(flags);
             return true;
         }
 
         return false;
     }
 
-    static bool save(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    bool saveAsync(const fs::path& path, SaveFlags flags, SaveCompleteCallback onComplete)
     {
-        try
+        if (isAsyncSaveInProgress())
+        {
+            return false;
+        }
+
+        // Packing objects requires unloading them which can only be done on the main thread
+        if (shouldPackObjects(flags) || (flags & SaveFlags::raw) || (flags & SaveFlags::dump))
         {
-            SawyerStreamWriter fs(path);
-            fs.writeChunk(SawyerEncoding::rotate, file.header);
-            if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
+            auto result = save(path, flags);
+            if (onComplete)
             {
-                fs.writeChunk(SawyerEncoding::rotate, *file.landscapeOptions);
+                onComplete(path, result, result ? std::string() : std::string("Unable to save S5"));
             }
-            if (file.header.flags & S5Flags::hasSaveDetails)
+            return true;
+        }
+
+        beginSave(flags);
+
+        // Snapshot the state now, everything after this point only touches the copy
+        auto requiredObjects = ObjectManager::getHeaders();
+        std::shared_ptr<S5File> file = prepareSaveFile(flags, requiredObjects, {});
+        ObjectManager::reloadAll();
+
+        auto deltaGeneration = getDeltaChainGeneration();
+        auto error = std::async(std::launch::async, [path, file, flags, deltaGeneration]() -> std::string {
+            try
             {
-                fs.writeChunk(SawyerEncoding::rotate, *file.saveDetails);
+                writeSave(path, *file, {}, flags, deltaGeneration);
+                return {};
             }
-            if (file.header.numPackedObjects != 0)
+            catch (const std::exception& e)
             {
-                writePackedObjects(fs, packedObjects);
+                return e.what();
             }
-            fs.writeChunk(SawyerEncoding::rotate, file.requiredObjects, sizeof(file.requiredObjects));
+        });
+        _asyncSave = AsyncSave{ path, flags, std::move(onComplete), std::move(error) };
+        return true;
+    }
+
+    bool isAsyncSaveInProgress()
+    {
+        return _asyncSave.has_value();
+    }
+
+    // Dispatches the completion callback of a finished background save on the main thread
+    void updateAsyncSave()
+    {
+        if (!_asyncSave || _asyncSave->error.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return;
+        }
+
+        auto asyncSave = std::move(*_asyncSave);
+        _asyncSave.reset();
+
+        auto error = asyncSave.error.get();
+        auto success = error.empty();
+        if (success)
+        {
+            onSaveComplete(asyncSave.flags);
+        }
+        else
+        {
+            std::fprintf(stderr, "Unable to save S5: %s\n", error.c_str());
+        }
+
+        if (asyncSave.onComplete)
+        {
+            asyncSave.onComplete(asyncSave.path, success, error);
+        }
+    }
+
+    void waitForAsyncSave()
+    {
+        if (_asyncSave)
+        {
+            _asyncSave->error.wait();
+            updateAsyncSave();
+        }
+    }
+
+    static bool save(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags)
+    {
+        try
+        {
+            writeSave(path, file, packedObjects, flags, getDeltaChainGeneration());
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            std::fprintf(stderr, "Unable to save S5: %s\n", e.what());
+            return false;
+        }
+    }
+
+    // Encodes and writes the file, this does not touch any global state unless objects need to be packed
+    static void writeFile(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    {
+        SawyerStreamWriter fs(path);
+        fs.writeChunk(SawyerEncoding::rotate, file.header);
+        if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
+        {
+            fs.writeChunk(SawyerEncoding::rotate, *file.landscapeOptions);
+        }
+        if (file.header.flags & S5Flags::hasSaveDetails)
+        {
+            fs.writeChunk(SawyerEncoding::rotate, *file.saveDetails);
+        }
+        if (file.header.numPackedObjects != 0)
+        {
+            writePackedObjects(fs, packedObjects);
+        }
+        fs.writeChunk(SawyerEncoding::rotate, file.requiredObjects, sizeof(file.requiredObjects));
+
+        if (file.header.type == S5Type::scenario)
+        {
+            fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.rng, 0xB96C);
+            fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
+            fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
+        }
+        else
+        {
+            fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+        }
+
+        if (file.header.flags & SaveFlags::raw)
+        {
+            throw NotImplementedException();
+        }
+        else
+        {
+            fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+        }
+
+        fs.writeChecksum();
+        fs.close();
+    }
+
+    static size_t getNumPages(size_t size)
+    {
+        return (size + deltaPageSize - 1) / deltaPageSize;
+    }
 
-            if (file.header.type == S5Type::scenario)
+    // The game state pages are followed by the tile element pages
+    static stdx::span<const uint8_t> getPage(stdx::span<const uint8_t> gameState, stdx::span<const uint8_t> tileElements, size_t index)
+    {
+        auto data = gameState;
+        auto numGameStatePages = getNumPages(gameState.size());
+        if (index >= numGameStatePages)
+        {
+            index -= numGameStatePages;
+            data = tileElements;
+        }
+        auto offset = index * deltaPageSize;
+        if (offset >= data.size())
+        {
+            return {};
+        }
+        return data.subspan(offset, std::min<size_t>(deltaPageSize, data.size() - offset));
+    }
+
+    static stdx::span<const uint8_t> getGameStateData(const S5File& file)
+    {
+        return stdx::span<const uint8_t>(reinterpret_cast<const uint8_t*>(&file.gameState), sizeof(file.gameState));
+    }
+
+    static stdx::span<const uint8_t> getTileElementData(const S5File& file)
+    {
+        return stdx::span<const uint8_t>(reinterpret_cast<const uint8_t*>(file.tileElements.data()), file.tileElements.size() * sizeof(TileElement));
+    }
+
+    static stdx::span<const uint8_t> getPage(const S5File& file, size_t index)
+    {
+        return getPage(getGameStateData(file), getTileElementData(file), index);
+    }
+
+    static stdx::span<uint8_t> getPage(S5File& file, size_t index)
+    {
+        auto page = getPage(static_cast<const S5File&>(file), index);
+        return stdx::span<uint8_t>(const_cast<uint8_t*>(page.data()), page.size());
+    }
+
+    static size_t getNumPages(const S5File& file)
+    {
+        return getNumPages(getGameStateData(file).size()) + getNumPages(getTileElementData(file).size());
+    }
+
+    static void writeDelta(const fs::path& path, const S5File& file, const DeltaChain& previous, const std::vector<uint32_t>& changedPages)
+    {
+        auto header = file.header;
+        header.flags |= S5Flags::isDelta;
+
+        DeltaHeader deltaHeader{};
+        deltaHeader.magic = deltaMagicNumber;
+        deltaHeader.version = deltaVersion;
+        deltaHeader.sequence = previous.length + 1;
+        std::strncpy(deltaHeader.previousFile, previous.lastPath.filename().u8string().c_str(), sizeof(deltaHeader.previousFile) - 1);
+        deltaHeader.pageSize = deltaPageSize;
+        deltaHeader.gameStateSize = sizeof(file.gameState);
+        deltaHeader.tileElementsSize = static_cast<uint32_t>(file.tileElements.size() * sizeof(TileElement));
+        deltaHeader.numPages = static_cast<uint32_t>(changedPages.size());
+
+        FastBuffer pageData;
+        for (auto index : changedPages)
+        {
+            auto page = getPage(file, index);
+            pageData.push_back(page.data(), page.size());
+        }
+
+        // Header, save details and required objects are laid out as in a full save so the file can still be previewed
+        SawyerStreamWriter fs(path);
+        fs.writeChunk(SawyerEncoding::rotate, header);
+        if (header.flags & S5Flags::hasSaveDetails)
+        {
+            fs.writeChunk(SawyerEncoding::rotate, *file.saveDetails);
+        }
+        fs.writeChunk(SawyerEncoding::rotate, file.requiredObjects, sizeof(file.requiredObjects));
+        fs.writeChunk(SawyerEncoding::rotate, deltaHeader);
+        fs.writeChunk(SawyerEncoding::uncompressed, changedPages.data(), changedPages.size() * sizeof(uint32_t));
+        fs.writeChunk(SawyerEncoding::runLengthSingle, pageData.data(), pageData.size());
+        fs.writeChecksum();
+        fs.close();
+    }
+
+    static void writeDeltaOrBase(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects, uint32_t generation)
+    {
+        // Take the chain so that the pages can be compared without holding the lock, if the write
+        // fails the chain stays empty and the next delta save starts a new one
+        DeltaChain previous;
+        {
+            std::lock_guard<std::mutex> lock(_deltaChainMutex);
+            if (generation != _deltaChainGeneration)
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.rng, 0xB96C);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
+                // A game has been loaded since the snapshot was taken
+                writeFile(path, file, packedObjects);
+                return;
             }
-            else
+            previous = std::move(_deltaChain);
+            _deltaChain = DeltaChain{};
+        }
+
+        auto startNewChain = previous.lastPath.empty()
+            || previous.length >= maxDeltaChainLength
+            || file.header.type != S5Type::savedGame
+            || file.header.numPackedObjects != 0
+            || previous.lastPath.parent_path() != path.parent_path()
+            || !fs::exists(previous.lastPath);
+
+        DeltaChain next;
+        if (startNewChain)
+        {
+            writeFile(path, file, packedObjects);
+        }
+        else
+        {
+            std::vector<uint32_t> changedPages;
+            auto numPages = getNumPages(file);
+            for (size_t i = 0; i < numPages; i++)
+            {
+                auto page = getPage(file, i);
+                auto previousPage = getPage(previous.gameState, previous.tileElements, i);
+                if (page.size() != previousPage.size() || std::memcmp(page.data(), previousPage.data(), page.size()) != 0)
+                {
+                    changedPages.push_back(static_cast<uint32_t>(i));
+                }
+            }
+
+            writeDelta(path, file, previous, changedPages);
+            next.length = previous.length + 1;
+        }
+
+        next.lastPath = path;
+        auto gameState = getGameStateData(file);
+        next.gameState.assign(gameState.begin(), gameState.end());
+        auto tileElements = getTileElementData(file);
+        next.tileElements.assign(tileElements.begin(), tileElements.end());
+
+        std::lock_guard<std::mutex> lock(_deltaChainMutex);
+        if (generation == _deltaChainGeneration)
+        {
+            _deltaChain = std::move(next);
+        }
+    }
+
+    // Called when a game is loaded or started, the next delta save starts a new chain
+    void resetDeltaChain()
+    {
+        std::lock_guard<std::mutex> lock(_deltaChainMutex);
+        _deltaChain = DeltaChain{};
+        _deltaChainGeneration++;
+    }
+
+    static void writeSave(const fs::path& path, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags, uint32_t deltaGeneration)
+    {
+        if (flags & SaveFlags::delta)
+        {
+            writeDeltaOrBase(path, file, packedObjects, deltaGeneration);
+        }
+        else
+        {
+            writeFile(path, file, packedObjects);
+        }
+    }
+
+    bool isDeltaFile(const fs::path& path)
+    {
+        try
+        {
+            SawyerStreamReader fs(path);
+            Header header;
+            fs.readChunk(&header, sizeof(header));
+            return (header.flags & S5Flags::isDelta) != 0;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    // Reads the state of a base file, or rebuilds it from the chain a delta file depends on
+    static void readChainFile(const fs::path& path, S5File& file, uint32_t depth)
+    {
+        if (depth > maxDeltaChainLength)
+        {
+            throw std::runtime_error("Delta chain too long");
+        }
+
+        SawyerStreamReader fs(path);
+        if (!fs.validateChecksum())
+        {
+            throw std::runtime_error("Invalid checksum");
+        }
+
+        Header header;
+        fs.readChunk(&header, sizeof(header));
+        if (header.type != S5Type::savedGame)
+        {
+            throw std::runtime_error("Delta chains only support saved games");
+        }
+
+        std::unique_ptr<SaveDetails> saveDetails;
+        if (header.flags & S5Flags::hasSaveDetails)
+        {
+            saveDetails = std::make_unique<SaveDetails>();
+            fs.readChunk(saveDetails.get(), sizeof(SaveDetails));
+        }
+
+        if (!(header.flags & S5Flags::isDelta))
+        {
+            for (uint16_t i = 0; i < header.numPackedObjects; i++)
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+                ObjectHeader objectHeader;
+                fs.read(&objectHeader, sizeof(objectHeader));
+                fs.readChunk();
             }
+            fs.readChunk(file.requiredObjects, sizeof(file.requiredObjects));
+            fs.readChunk(&file.gameState, sizeof(file.gameState));
+
+            auto tileElements = fs.readChunk();
+            file.tileElements.resize(tileElements.size() / sizeof(TileElement));
+            std::memcpy(file.tileElements.data(), tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+        }
+        else
+        {
+            fs.readChunk(file.requiredObjects, sizeof(file.requiredObjects));
 
-            if (file.header.flags & SaveFlags::raw)
+            DeltaHeader deltaHeader;
+            fs.readChunk(&deltaHeader, sizeof(deltaHeader));
+            if (deltaHeader.magic != deltaMagicNumber || deltaHeader.version != deltaVersion || deltaHeader.pageSize != deltaPageSize || deltaHeader.gameStateSize != sizeof(GameState))
             {
-                throw NotImplementedException();
+                throw std::runtime_error("Unsupported delta file");
             }
-            else
+            deltaHeader.previousFile[sizeof(deltaHeader.previousFile) - 1] = '\0';
+
+            // Required objects of this file take precedence over the ones of the previous file
+            auto requiredObjects = std::make_unique<ObjectHeader[]>(std::size(file.requiredObjects));
+            std::memcpy(requiredObjects.get(), file.requiredObjects, sizeof(file.requiredObjects));
+            readChainFile(path.parent_path() / fs::u8path(deltaHeader.previousFile), file, depth + 1);
+            std::memcpy(file.requiredObjects, requiredObjects.get(), sizeof(file.requiredObjects));
+
+            file.tileElements.resize(deltaHeader.tileElementsSize / sizeof(TileElement));
+
+            std::vector<uint32_t> changedPages(deltaHeader.numPages);
+            fs.readChunk(changedPages.data(), changedPages.size() * sizeof(uint32_t));
+            auto pageData = fs.readChunk();
+            size_t offset = 0;
+            for (auto index : changedPages)
             {
-                fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+                auto page = getPage(file, index);
+                if (page.empty() || offset + page.size() > pageData.size())
+                {
+                    throw std::runtime_error("Invalid delta page");
+                }
+                std::memcpy(page.data(), &pageData[offset], page.size());
+                offset += page.size();
             }
+        }
 
-            fs.writeChecksum();
-            fs.close();
+        header.flags &= ~S5Flags::isDelta;
+        header.numPackedObjects = 0;
+        file.header = header;
+        file.saveDetails = std::move(saveDetails);
+    }
+
+    // Writes the state described by a delta file and its chain as a regular saved game
+    bool rebuildFromDeltaChain(const fs::path& deltaPath, const fs::path& outputPath)
+    {
+        try
+        {
+            auto file = std::make_unique<S5File>();
+            readChainFile(deltaPath, *file, 0);
+            writeFile(outputPath, *file, {});
             return true;
         }
         catch (const std::exception& e)
         {
-            std::fprintf(stderr, "Unable to save S5: %s\n", e.what());
+            std::fprintf(stderr, "Unable to rebuild delta save: %s\n", e.what());
             return false;
         }
     }
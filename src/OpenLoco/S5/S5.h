@@ -3,7 +3,9 @@
 #include "../Core/FileSystem.hpp"
 #include "../Objects/ObjectManager.h"
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 
 namespace OpenLoco::S5
 {
@@ -19,6 +21,7 @@ namespace OpenLoco::S5
         isRaw = 1 << 0,
         isDump = 1 << 1,
         hasSaveDetails = 1 << 3,
+        isDelta = 1 << 4, // OpenLoco extension: only holds the pages that changed since the previous file of the chain
     };
 
 #pragma pack(push, 1)
@@ -266,6 +269,7 @@ namespace OpenLoco::S5
         packCustomObjects = 1 << 0,
         scenario = 1 << 1,
         landscape = 1 << 2,
+        delta = 1 << 3, // Write only the pages changed since the previous delta save, or a new base if there is none
         noWindowClose = 1u << 29,
         raw = 1u << 30,  // Save raw data including pointers with no clean up
         dump = 1u << 31, // Used for dumping the game state when there is a fatal error
@@ -277,8 +281,28 @@ namespace OpenLoco::S5
     constexpr const char* filterSC5 = "*.SC5";
     constexpr const char* filterSV5 = "*.SV5";
 
+    /**
+     * Called on the main thread once a background save has finished.
+     * error is empty when the save succeeded.
+     */
+    using SaveCompleteCallback = std::function<void(const fs::path& path, bool success, const std::string& error)>;
+
     Options& getOptions();
     Options& getPreviewOptions();
     bool save(const fs::path& path, SaveFlags flags);
+
+    /**
+     * Snapshots the game state on the calling thread and encodes / writes it on a worker thread.
+     * Falls back to a synchronous save when the flags require objects to be packed or raw data.
+     * Returns false if another background save is still in progress.
+     */
+    bool saveAsync(const fs::path& path, SaveFlags flags, SaveCompleteCallback onComplete);
+    bool isAsyncSaveInProgress();
+    void updateAsyncSave();
+    void waitForAsyncSave();
+
+    bool isDeltaFile(const fs::path& path);
+    bool rebuildFromDeltaChain(const fs::path& deltaPath, const fs::path& outputPath);
+    void resetDeltaChain();
     void registerHooks();
 }
@@ -3,8 +3,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -12,6 +14,11 @@
 #endif
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 using namespace OpenLoco;
@@ -19,6 +26,8 @@ using namespace OpenLoco::Utility;
 
 constexpr const char* exceptionInvalidRLE = "Invalid RLE run";
 constexpr const char* exceptionUnknownEncoding = "Unknown encoding";
+constexpr const char* exceptionEndOfFile = "Unexpected end of file";
+constexpr const char* exceptionMapFile = "Unable to map file";
 
 uint8_t* FastBuffer::alloc(size_t len)
 {
@@ -124,13 +133,114 @@ stdx::span<uint8_t const> FastBuffer::getSpan() const
     return stdx::span<uint8_t const>(_data, _len);
 }
 
+MemoryMappedFile::MemoryMappedFile(const fs::path& path)
+{
+#ifdef _WIN32
+    auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error(exceptionMapFile);
+    }
+    _file = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        close();
+        throw std::runtime_error(exceptionMapFile);
+    }
+    _len = static_cast<size_t>(fileSize.QuadPart);
+    if (_len == 0)
+    {
+        return;
+    }
+
+    _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mapping == nullptr)
+    {
+        close();
+        throw std::runtime_error(exceptionMapFile);
+    }
+    _data = reinterpret_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw std::runtime_error(exceptionMapFile);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error(exceptionMapFile);
+    }
+    _len = static_cast<size_t>(st.st_size);
+    if (_len == 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    auto mapping = mmap(nullptr, _len, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    _data = mapping == MAP_FAILED ? nullptr : reinterpret_cast<const uint8_t*>(mapping);
+    if (_data != nullptr)
+    {
+        madvise(mapping, _len, MADV_SEQUENTIAL);
+    }
+#endif
+    if (_data == nullptr)
+    {
+        close();
+        throw std::runtime_error(exceptionMapFile);
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+stdx::span<uint8_t const> MemoryMappedFile::getSpan() const
+{
+    return stdx::span<uint8_t const>(_data, _data == nullptr ? 0 : _len);
+}
+
+void MemoryMappedFile::close()
+{
+#ifdef _WIN32
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping != nullptr)
+    {
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+    }
+    if (_file != nullptr)
+    {
+        CloseHandle(_file);
+        _file = nullptr;
+    }
+#else
+    if (_data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(_data), _len);
+    }
+#endif
+    _data = nullptr;
+    _len = 0;
+}
+
 SawyerStreamReader::SawyerStreamReader(const fs::path& path)
+    : _file(path)
 {
-    _stream.exceptions(std::ifstream::failbit);
-    _stream.open(path, std::ios::in | std::ios::binary);
 }
 
-stdx::span<uint8_t const> SawyerStreamReader::readChunk()
+std::pair<SawyerEncoding, stdx::span<uint8_t const>> SawyerStreamReader::locateChunk()
 {
     SawyerEncoding encoding;
     read(&encoding, sizeof(encoding));
@@ -138,10 +248,20 @@ stdx::span<uint8_t const> SawyerStreamReader::readChunk()
     uint32_t length;
     read(&length, sizeof(length));
 
-    _decodeBuffer.resize(length);
-    read(_decodeBuffer.data(), length);
+    auto fileData = _file.getSpan();
+    if (length > fileData.size() - _position)
+    {
+        throw std::runtime_error(exceptionEndOfFile);
+    }
+    auto chunkData = fileData.subspan(_position, length);
+    _position += length;
+    return { encoding, chunkData };
+}
 
-    return decode(encoding, _decodeBuffer.getSpan());
+stdx::span<uint8_t const> SawyerStreamReader::readChunk()
+{
+    auto [encoding, data] = locateChunk();
+    return decode(encoding, data, _decodeBuffer, _decodeBuffer2);
 }
 
 size_t SawyerStreamReader::readChunk(void* data, size_t maxDataLen)
@@ -153,76 +273,92 @@ size_t SawyerStreamReader::readChunk(void* data, size_t maxDataLen)
 
 void SawyerStreamReader::read(void* data, size_t dataLen)
 {
-    _stream.read(reinterpret_cast<char*>(data), dataLen);
+    auto fileData = _file.getSpan();
+    if (dataLen > fileData.size() - _position)
+    {
+        throw std::runtime_error(exceptionEndOfFile);
+    }
+    std::memcpy(data, fileData.data() + _position, dataLen);
+    _position += dataLen;
 }
 
 bool SawyerStreamReader::validateChecksum()
 {
-    auto valid = false;
-    auto backupPos = _stream.tellg();
-
-    _stream.seekg(0, std::ios::end);
-    auto fileLength = static_cast<uint32_t>(_stream.tellg());
-    if (fileLength >= 4)
+    auto fileData = _file.getSpan();
+    if (fileData.size() < 4)
     {
-        // Read checksum
-        uint32_t checksum;
-        _stream.seekg(fileLength - 4);
-        _stream.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+        return false;
+    }
 
-        // Calculate checksum
-        uint32_t actualChecksum = 0;
-        _stream.seekg(0);
-        uint8_t buffer[2048];
-        for (uint32_t i = 0; i < fileLength - 4; i += sizeof(buffer))
+    uint32_t checksum;
+    std::memcpy(&checksum, fileData.data() + fileData.size() - 4, sizeof(checksum));
+    return checksum == calculateChecksum(fileData.first(fileData.size() - 4));
+}
+
+// Sum of all bytes, processes 8 bytes at a time by adding them as four 16-bit lanes
+uint32_t SawyerStreamReader::calculateChecksum(stdx::span<uint8_t const> data)
+{
+    constexpr uint64_t laneMask = 0x00FF00FF00FF00FFull;
+
+    // Each iteration adds at most 2 * 255 to a lane, so flush before a 16-bit lane can overflow
+    constexpr size_t maxBlocksPerFlush = 128;
+
+    uint32_t result = 0;
+    auto src = data.data();
+    auto remaining = data.size();
+    while (remaining >= sizeof(uint64_t))
+    {
+        auto numBlocks = std::min(remaining / sizeof(uint64_t), maxBlocksPerFlush);
+        uint64_t lanes = 0;
+        for (size_t i = 0; i < numBlocks; i++)
         {
-            auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
-            _stream.read(reinterpret_cast<char*>(buffer), readLength);
-            for (size_t j = 0; j < readLength; j++)
-            {
-                actualChecksum += buffer[j];
-            }
+            uint64_t block;
+            std::memcpy(&block, src, sizeof(block));
+            lanes += (block & laneMask) + ((block >> 8) & laneMask);
+            src += sizeof(block);
         }
+        remaining -= numBlocks * sizeof(uint64_t);
 
-        valid = checksum == actualChecksum;
+        lanes = (lanes & 0x0000FFFF0000FFFFull) + ((lanes >> 16) & 0x0000FFFF0000FFFFull);
+        result += static_cast<uint32_t>(lanes) + static_cast<uint32_t>(lanes >> 32);
     }
-
-    // Restore position
-    _stream.seekg(backupPos);
-
-    return valid;
+    for (size_t i = 0; i < remaining; i++)
+    {
+        result += src[i];
+    }
+    return result;
 }
 
 void SawyerStreamReader::close()
 {
-    _stream.close();
+    _file.close();
 }
 
-stdx::span<uint8_t const> SawyerStreamReader::decode(SawyerEncoding encoding, stdx::span<uint8_t const> data)
+stdx::span<uint8_t const> SawyerStreamReader::decode(SawyerEncoding encoding, stdx::span<uint8_t const> data, FastBuffer& buffer, FastBuffer& buffer2)
 {
     switch (encoding)
     {
         case SawyerEncoding::uncompressed:
             return data;
         case SawyerEncoding::runLengthSingle:
-            _decodeBuffer2.clear();
-            _decodeBuffer2.reserve(data.size());
-            decodeRunLengthSingle(_decodeBuffer2, data);
-            return _decodeBuffer2.getSpan();
+            buffer2.clear();
+            buffer2.reserve(data.size());
+            decodeRunLengthSingle(buffer2, data);
+            return buffer2.getSpan();
         case SawyerEncoding::runLengthMulti:
-            _decodeBuffer2.clear();
-            _decodeBuffer2.reserve(data.size());
-            decodeRunLengthSingle(_decodeBuffer2, data);
-
-            _decodeBuffer.clear();
-            _decodeBuffer.reserve(_decodeBuffer2.size());
-            decodeRunLengthMulti(_decodeBuffer, _decodeBuffer2.getSpan());
-            return _decodeBuffer.getSpan();
+            buffer2.clear();
+            buffer2.reserve(data.size());
+            decodeRunLengthSingle(buffer2, data);
+
+            buffer.clear();
+            buffer.reserve(buffer2.size());
+            decodeRunLengthMulti(buffer, buffer2.getSpan());
+            return buffer.getSpan();
         case SawyerEncoding::rotate:
-            _decodeBuffer2.clear();
-            _decodeBuffer2.reserve(data.size());
-            decodeRotate(_decodeBuffer2, data);
-            return _decodeBuffer2.getSpan();
+            buffer2.clear();
+            buffer2.reserve(data.size());
+            decodeRotate(buffer2, data);
+            return buffer2.getSpan();
         default:
             throw std::runtime_error(exceptionUnknownEncoding);
     }
@@ -311,7 +447,7 @@ SawyerStreamWriter::SawyerStreamWriter(const fs::path& path)
 
 void SawyerStreamWriter::writeChunk(SawyerEncoding chunkType, const void* data, size_t dataLen)
 {
-    auto encodedData = encode(chunkType, stdx::span(reinterpret_cast<const uint8_t*>(data), dataLen));
+    auto encodedData = encode(chunkType, stdx::span(reinterpret_cast<const uint8_t*>(data), dataLen), _encodeBuffer, _encodeBuffer2);
     write(&chunkType, sizeof(chunkType));
     write(static_cast<uint32_t>(encodedData.size()));
     write(encodedData.data(), encodedData.size());
@@ -337,31 +473,31 @@ void SawyerStreamWriter::close()
     _stream.close();
 }
 
-stdx::span<uint8_t const> SawyerStreamWriter::encode(SawyerEncoding encoding, stdx::span<uint8_t const> data)
+stdx::span<uint8_t const> SawyerStreamWriter::encode(SawyerEncoding encoding, stdx::span<uint8_t const> data, FastBuffer& buffer, FastBuffer& buffer2)
 {
     switch (encoding)
     {
         case SawyerEncoding::uncompressed:
             return data;
         case SawyerEncoding::runLengthSingle:
-            _encodeBuffer.clear();
-            _encodeBuffer.reserve(data.size());
-            encodeRunLengthSingle(_encodeBuffer, data);
-            return _encodeBuffer.getSpan();
+            buffer.clear();
+            buffer.reserve(data.size());
+            encodeRunLengthSingle(buffer, data);
+            return buffer.getSpan();
         case SawyerEncoding::runLengthMulti:
-            _encodeBuffer.clear();
-            _encodeBuffer.reserve(data.size());
-            encodeRunLengthMulti(_encodeBuffer, data);
-
-            _encodeBuffer2.clear();
-            _encodeBuffer2.reserve(_encodeBuffer.size());
-            encodeRunLengthSingle(_encodeBuffer2, _encodeBuffer.getSpan());
-            return _encodeBuffer2.getSpan();
+            buffer.clear();
+            buffer.reserve(data.size());
+            encodeRunLengthMulti(buffer, data);
+
+            buffer2.clear();
+            buffer2.reserve(buffer.size());
+            encodeRunLengthSingle(buffer2, buffer.getSpan());
+            return buffer2.getSpan();
         case SawyerEncoding::rotate:
-            _encodeBuffer.clear();
-            _encodeBuffer.reserve(data.size());
-            encodeRotate(_encodeBuffer, data);
-            return _encodeBuffer.getSpan();
+            buffer.clear();
+            buffer.reserve(data.size());
+            encodeRotate(buffer, data);
+            return buffer.getSpan();
         default:
             throw std::runtime_error(exceptionUnknownEncoding);
     }
@@ -415,13 +551,50 @@ void SawyerStreamWriter::encodeRunLengthSingle(FastBuffer& buffer, stdx::span<ui
     }
 }
 
+// Returns the number of equal leading bytes of a and b (up to 8), both must have at least 8 readable bytes
+static size_t countMatchingBytes(const uint8_t* a, const uint8_t* b)
+{
+    uint32_t a32[2];
+    uint32_t b32[2];
+    std::memcpy(a32, a, sizeof(a32));
+    std::memcpy(b32, b, sizeof(b32));
+
+    // Lowest set bit of the difference is the first mismatching byte (little endian)
+    auto diff = a32[0] ^ b32[0];
+    if (diff != 0)
+    {
+        return bitScanForward(diff) / 8;
+    }
+    diff = a32[1] ^ b32[1];
+    if (diff != 0)
+    {
+        return 4 + bitScanForward(diff) / 8;
+    }
+    return 8;
+}
+
+/**
+ * Produces the same output as a brute force search of the 32 byte window: the longest repeat
+ * (up to 8 bytes, never longer than its distance) is chosen, the farthest one winning ties.
+ * Only candidates starting with the same two bytes are compared (found via a hash chain),
+ * otherwise the farthest single byte match is used.
+ */
 void SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data)
 {
+    constexpr size_t windowSize = 32;
+    constexpr uint32_t noPosition = std::numeric_limits<uint32_t>::max();
+
     auto src = data.data();
     auto srcLen = data.size();
     if (srcLen == 0)
         return;
 
+    // Most recent position of each two byte sequence, and for each position in the window
+    // the previous position of the same sequence
+    std::vector<uint32_t> chainHead(0x10000, noPosition);
+    uint32_t chain[windowSize];
+    size_t numInserted = 0;
+
     // Need to emit at least one byte, otherwise there is nothing to repeat
     buffer.push_back(255);
     buffer.push_back(src[0]);
@@ -429,37 +602,73 @@ void SawyerStreamWriter::encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uin
     // Iterate through remainder of the source buffer
     for (size_t i = 1; i < srcLen;)
     {
-        size_t searchIndex = (i < 32) ? 0 : (i - 32);
-        size_t searchEnd = i - 1;
+        for (; numInserted < i; numInserted++)
+        {
+            auto key = src[numInserted] | (src[numInserted + 1] << 8);
+            chain[numInserted % windowSize] = chainHead[key];
+            chainHead[key] = static_cast<uint32_t>(numInserted);
+        }
+
+        size_t searchIndex = (i < windowSize) ? 0 : (i - windowSize);
+        size_t maxRemaining = std::min<size_t>(8, srcLen - i);
+        bool canCompareWords = srcLen - i >= 8;
 
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+        if (maxRemaining >= 2)
         {
-            size_t repeatCount = 0;
-            size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), srcLen - i - 1);
-            // maxRepeatCount should not exceed srcLen
-            assert(repeatIndex + maxRepeatCount < srcLen);
-            assert(i + maxRepeatCount < srcLen);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
+            // Chain is ordered nearest first, but the farthest candidate has to win ties
+            uint32_t candidates[windowSize];
+            size_t numCandidates = 0;
+            for (auto r = chainHead[src[i] | (src[i + 1] << 8)]; r != noPosition && r >= searchIndex; r = chain[r % windowSize])
+            {
+                candidates[numCandidates++] = r;
+            }
+
+            while (numCandidates > 0)
             {
-                if (src[repeatIndex + j] == src[i + j])
+                size_t repeatIndex = candidates[--numCandidates];
+
+                // Repeats can not overlap the current position, nearer candidates are limited even further
+                size_t maxRepeatCount = std::min(i - repeatIndex, maxRemaining);
+                if (maxRepeatCount <= bestRepeatCount)
+                    break;
+
+                size_t repeatCount;
+                if (canCompareWords)
                 {
-                    repeatCount++;
+                    repeatCount = std::min(countMatchingBytes(&src[repeatIndex], &src[i]), maxRepeatCount);
                 }
                 else
                 {
-                    break;
+                    repeatCount = 2;
+                    while (repeatCount < maxRepeatCount && src[repeatIndex + repeatCount] == src[i + repeatCount])
+                    {
+                        repeatCount++;
+                    }
+                    repeatCount = std::min(repeatCount, maxRepeatCount);
+                }
+
+                if (repeatCount > bestRepeatCount)
+                {
+                    bestRepeatIndex = repeatIndex;
+                    bestRepeatCount = repeatCount;
+
+                    // Maximum repeat count is 8
+                    if (repeatCount == 8)
+                        break;
                 }
             }
-            if (repeatCount > bestRepeatCount)
-            {
-                bestRepeatIndex = repeatIndex;
-                bestRepeatCount = repeatCount;
+        }
 
-                // Maximum repeat count is 8
-                if (repeatCount == 8)
-                    break;
+        if (bestRepeatCount < 2)
+        {
+            // No longer repeat, so any earlier occurrence of the byte repeats exactly one byte
+            auto match = std::memchr(&src[searchIndex], src[i], i - searchIndex);
+            if (match != nullptr)
+            {
+                bestRepeatIndex = static_cast<const uint8_t*>(match) - src;
+                bestRepeatCount = 1;
             }
         }
 
@@ -4,6 +4,7 @@
 #include "../Core/Span.hpp"
 #include <cstdint>
 #include <fstream>
+#include <utility>
 
 namespace OpenLoco
 {
@@ -35,8 +36,12 @@ namespace OpenLoco
         static void free(uint8_t* ptr);
 
     public:
+        FastBuffer() = default;
+        FastBuffer(const FastBuffer&) = delete;
         ~FastBuffer();
 
+        FastBuffer& operator=(const FastBuffer&) = delete;
+
         uint8_t* data();
         size_t size() const;
         void resize(size_t len);
@@ -48,14 +53,45 @@ namespace OpenLoco
         stdx::span<uint8_t const> getSpan() const;
     };
 
+    /**
+     * Read-only view of a whole file mapped into memory.
+     */
+    class MemoryMappedFile
+    {
+    private:
+        const uint8_t* _data{};
+        size_t _len{};
+#ifdef _WIN32
+        void* _file{};
+        void* _mapping{};
+#endif
+
+    public:
+        MemoryMappedFile(const fs::path& path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        stdx::span<uint8_t const> getSpan() const;
+        void close();
+    };
+
+    /**
+     * Reads a sawyer encoded file (S5, SV5, SC5 or DAT) by mapping it into memory.
+     * Uncompressed chunks are returned without copying.
+     * Only the delta save chain is read with this so far, regular games are still loaded by the
+     * original routine 0x00441FA7.
+     */
     class SawyerStreamReader
     {
     private:
-        std::ifstream _stream;
+        MemoryMappedFile _file;
+        size_t _position{};
         FastBuffer _decodeBuffer;
         FastBuffer _decodeBuffer2;
 
-        stdx::span<uint8_t const> decode(SawyerEncoding encoding, stdx::span<uint8_t const> data);
+        std::pair<SawyerEncoding, stdx::span<uint8_t const>> locateChunk();
         static void decodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void decodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void decodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data);
@@ -68,6 +104,9 @@ namespace OpenLoco
         void read(void* data, size_t dataLen);
         bool validateChecksum();
         void close();
+
+        static uint32_t calculateChecksum(stdx::span<uint8_t const> data);
+        static stdx::span<uint8_t const> decode(SawyerEncoding encoding, stdx::span<uint8_t const> data, FastBuffer& buffer, FastBuffer& buffer2);
     };
 
     class SawyerStreamWriter
@@ -78,7 +117,6 @@ namespace OpenLoco
         FastBuffer _encodeBuffer;
         FastBuffer _encodeBuffer2;
 
-        stdx::span<uint8_t const> encode(SawyerEncoding encoding, stdx::span<uint8_t const> data);
         static void encodeRunLengthSingle(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void encodeRunLengthMulti(FastBuffer& buffer, stdx::span<uint8_t const> data);
         static void encodeRotate(FastBuffer& buffer, stdx::span<uint8_t const> data);
@@ -91,6 +129,8 @@ namespace OpenLoco
         void writeChecksum();
         void close();
 
+        static stdx::span<uint8_t const> encode(SawyerEncoding encoding, stdx::span<uint8_t const> data, FastBuffer& buffer, FastBuffer& buffer2);
+
         template<typename T>
         void writeChunk(SawyerEncoding chunkType, const T& data)
         {
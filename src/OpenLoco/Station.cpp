@@ -18,6 +18,7 @@
 #include "ViewportManager.h"
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Map;
@@ -164,6 +165,21 @@ namespace OpenLoco
     static void sub_491BF5(const Pos2& pos, const uint8_t flag);
     static StationElement* getStationElement(const Pos3& pos);
 
+    // Smallest rectangle of tiles containing all the catchment regions added to it
+    struct CatchmentBounds
+    {
+        TilePos2 min{ map_columns, map_rows };
+        TilePos2 max{ -1, -1 };
+
+        void add(const TilePos2& minPos, const TilePos2& maxPos)
+        {
+            min.x = std::min(min.x, std::max(minPos.x, static_cast<coord_t>(0)));
+            min.y = std::min(min.y, std::max(minPos.y, static_cast<coord_t>(0)));
+            max.x = std::max(max.x, std::min(maxPos.x, static_cast<coord_t>(map_columns - 1)));
+            max.y = std::max(max.y, std::min(maxPos.y, static_cast<coord_t>(map_rows - 1)));
+        }
+    };
+
     StationId_t Station::id() const
     {
         // TODO check if this is stored in station structure
@@ -238,6 +254,88 @@ namespace OpenLoco
         }
     }
 
+    // Calls fn with the (unclamped) catchment rectangle of each of the station's tiles
+    template<typename TFunc>
+    static void forEachCatchmentRegion(const Station& station, TFunc&& fn)
+    {
+        for (uint16_t i = 0; i < station.stationTileSize; i++)
+        {
+            auto pos = station.stationTiles[i];
+            pos.z &= ~((1 << 1) | (1 << 0));
+
+            auto stationElement = getStationElement(pos);
+
+            if (stationElement == nullptr)
+                continue;
+
+            switch (stationElement->stationType())
+            {
+                case StationType::airport:
+                {
+                    auto airportObject = ObjectManager::get<AirportObject>(stationElement->objectId());
+
+                    Pos2 minPos(airportObject->min_x * 32, airportObject->min_y * 32);
+                    Pos2 maxPos(airportObject->max_x * 32, airportObject->max_y * 32);
+
+                    minPos = rotate2dCoordinate(minPos, stationElement->rotation());
+                    maxPos = rotate2dCoordinate(maxPos, stationElement->rotation());
+
+                    minPos.x += pos.x;
+                    minPos.y += pos.y;
+                    maxPos.x += pos.x;
+                    maxPos.y += pos.y;
+
+                    if (minPos.x > maxPos.x)
+                    {
+                        std::swap(minPos.x, maxPos.x);
+                    }
+
+                    if (minPos.y > maxPos.y)
+                    {
+                        std::swap(minPos.y, maxPos.y);
+                    }
+
+                    TilePos2 tileMinPos(minPos);
+                    TilePos2 tileMaxPos(maxPos);
+
+                    tileMinPos.x -= catchmentSize;
+                    tileMinPos.y -= catchmentSize;
+                    tileMaxPos.x += catchmentSize;
+                    tileMaxPos.y += catchmentSize;
+
+                    fn(tileMinPos, tileMaxPos);
+                }
+                break;
+                case StationType::docks:
+                {
+                    TilePos2 minPos(pos);
+                    auto maxPos = minPos;
+
+                    minPos.x -= catchmentSize;
+                    minPos.y -= catchmentSize;
+                    // Docks are always size 2x2
+                    maxPos.x += catchmentSize + 1;
+                    maxPos.y += catchmentSize + 1;
+
+                    fn(minPos, maxPos);
+                }
+                break;
+                default:
+                {
+                    TilePos2 minPos(pos);
+                    auto maxPos = minPos;
+
+                    minPos.x -= catchmentSize;
+                    minPos.y -= catchmentSize;
+                    maxPos.x += catchmentSize;
+                    maxPos.y += catchmentSize;
+
+                    fn(minPos, maxPos);
+                }
+            }
+        }
+    }
+
     // 0x00491FE0
     // WARNING: this may be called with station (ebp) = -1
     // filter only used if location.x != -1
@@ -302,9 +400,28 @@ namespace OpenLoco
             cargoSearchState.filter(~0);
         }
 
-        for (tile_coord_t ty = 0; ty < map_columns; ty++)
+        // Only tiles within the catchment regions set above can be flagged
+        CatchmentBounds bounds;
+        if (this != (Station*)0xFFFFFFFF)
+        {
+            forEachCatchmentRegion(*this, [&bounds](const TilePos2& minPos, const TilePos2& maxPos) {
+                bounds.add(minPos, maxPos);
+            });
+        }
+        if (location.x != -1)
+        {
+            TilePos2 minPos(location);
+            auto maxPos = minPos;
+            maxPos.x += catchmentSize;
+            maxPos.y += catchmentSize;
+            minPos.x -= catchmentSize;
+            minPos.y -= catchmentSize;
+            bounds.add(minPos, maxPos);
+        }
+
+        for (tile_coord_t ty = bounds.min.y; ty <= bounds.max.y; ty++)
         {
-            for (tile_coord_t tx = 0; tx < map_rows; tx++)
+            for (tile_coord_t tx = bounds.min.x; tx <= bounds.max.x; tx++)
             {
                 if (cargoSearchState.mapHas2(tx, ty))
                 {
@@ -442,82 +559,9 @@ namespace OpenLoco
         if (stationTileSize == 0)
             return;
 
-        for (uint16_t i = 0; i < stationTileSize; i++)
-        {
-            auto pos = stationTiles[i];
-            pos.z &= ~((1 << 1) | (1 << 0));
-
-            auto stationElement = getStationElement(pos);
-
-            if (stationElement == nullptr)
-                continue;
-
-            switch (stationElement->stationType())
-            {
-                case StationType::airport:
-                {
-                    auto airportObject = ObjectManager::get<AirportObject>(stationElement->objectId());
-
-                    Pos2 minPos(airportObject->min_x * 32, airportObject->min_y * 32);
-                    Pos2 maxPos(airportObject->max_x * 32, airportObject->max_y * 32);
-
-                    minPos = rotate2dCoordinate(minPos, stationElement->rotation());
-                    maxPos = rotate2dCoordinate(maxPos, stationElement->rotation());
-
-                    minPos.x += pos.x;
-                    minPos.y += pos.y;
-                    maxPos.x += pos.x;
-                    maxPos.y += pos.y;
-
-                    if (minPos.x > maxPos.x)
-                    {
-                        std::swap(minPos.x, maxPos.x);
-                    }
-
-                    if (minPos.y > maxPos.y)
-                    {
-                        std::swap(minPos.y, maxPos.y);
-                    }
-
-                    TilePos2 tileMinPos(minPos);
-                    TilePos2 tileMaxPos(maxPos);
-
-                    tileMinPos.x -= catchmentSize;
-                    tileMinPos.y -= catchmentSize;
-                    tileMaxPos.x += catchmentSize;
-                    tileMaxPos.y += catchmentSize;
-
-                    setStationCatchmentRegion(cargoSearchState, tileMinPos, tileMaxPos, catchmentFlag);
-                }
-                break;
-                case StationType::docks:
-                {
-                    TilePos2 minPos(pos);
-                    auto maxPos = minPos;
-
-                    minPos.x -= catchmentSize;
-                    minPos.y -= catchmentSize;
-                    // Docks are always size 2x2
-                    maxPos.x += catchmentSize + 1;
-                    maxPos.y += catchmentSize + 1;
-
-                    setStationCatchmentRegion(cargoSearchState, minPos, maxPos, catchmentFlag);
-                }
-                break;
-                default:
-                {
-                    TilePos2 minPos(pos);
-                    auto maxPos = minPos;
-
-                    minPos.x -= catchmentSize;
-                    minPos.y -= catchmentSize;
-                    maxPos.x += catchmentSize;
-                    maxPos.y += catchmentSize;
-
-                    setStationCatchmentRegion(cargoSearchState, minPos, maxPos, catchmentFlag);
-                }
-            }
-        }
+        forEachCatchmentRegion(*this, [&cargoSearchState, catchmentFlag](const TilePos2& minPos, const TilePos2& maxPos) {
+            setStationCatchmentRegion(cargoSearchState, minPos, maxPos, catchmentFlag);
+        });
     }
 
     // 0x0049B4E0
@@ -563,8 +607,123 @@ namespace OpenLoco
         return StringManager::formatString(ptr, suffix);
     }
 
+    // The per cargo fields read and written by the rating update, gathered from all stations
+    // into contiguous arrays so that the rating calculation can run as one vectorisable loop
+    struct CargoRatingBatch
+    {
+        std::vector<Station*> stations;
+        std::vector<uint8_t> cargoIndex;
+        std::vector<uint16_t> quantity;
+        std::vector<uint8_t> age;
+        std::vector<uint8_t> enrouteAge;
+        std::vector<uint8_t> rating;
+        std::vector<uint8_t> var36;
+        std::vector<uint8_t> var38;
+        std::vector<uint8_t> ageEnroute; // Non zero if enroute_age should be aged
+        std::vector<uint8_t> fixedRating; // Non zero if the station's base rating is fixed at 120
+
+        void clear()
+        {
+            stations.clear();
+            cargoIndex.clear();
+            quantity.clear();
+            age.clear();
+            enrouteAge.clear();
+            rating.clear();
+            var36.clear();
+            var38.clear();
+            ageEnroute.clear();
+            fixedRating.clear();
+        }
+    };
+
+    static CargoRatingBatch _cargoRatingBatch;
+
+    // Same as calculateCargoRating with each branch turned into arithmetic on its condition. The
+    // thresholds of each nested branch are strictly inside the previous one so adding the bonuses of
+    // every satisfied condition is equivalent.
+    static void calculateCargoRatings(const size_t count, const uint16_t* quantity, const uint8_t* age, uint8_t* rating, const uint8_t* var36, const uint8_t* var38, const uint8_t* fixedRating)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const int32_t cargoAge = age[i];
+            const int32_t freshBonus = (cargoAge <= 45) * 40 + (cargoAge <= 30) * 45 + (cargoAge <= 15) * 45 + (cargoAge <= 7) * 35;
+
+            const int32_t cargoQuantity = quantity[i];
+            const int32_t waitingBonus = (cargoQuantity <= 1000) * 30 + (cargoQuantity <= 500) * 30 + (cargoQuantity <= 300) * 30 + (cargoQuantity <= 200) * 20 + (cargoQuantity <= 100) * 20;
+
+            int32_t target = fixedRating[i] ? 120 : freshBonus - 130 + waitingBonus;
+
+            const int32_t unk3 = std::min<int32_t>(var36[i], 250);
+            target += (unk3 < 35) * (unk3 / 4);
+
+            const int32_t unk4 = var38[i];
+            target += (unk4 < 4) * 10 + (unk4 < 2) * 10 + (unk4 < 1) * 13;
+
+            target = std::clamp<int32_t>(target, min_cargo_rating, max_cargo_rating);
+
+            // Limit to +/- 2 minimum change
+            rating[i] += std::clamp<int32_t>(target - rating[i], -2, 2);
+        }
+    }
+
+    // Part of 0x00492793
+    // Ages the cargo of each station and moves its ratings towards the target rating, leaving
+    // Station::updateCargo(true) to do the random quantity changes in the original order.
+    void updateCargoRatings(stdx::span<Station* const> stations)
+    {
+        auto& batch = _cargoRatingBatch;
+        batch.clear();
+
+        for (auto* station : stations)
+        {
+            const bool fixedRating = (station->flags & (StationFlags::flag_7 | StationFlags::flag_8)) == 0 && !isPlayerCompany(station->owner);
+            const auto stationId = station->id();
+            for (uint8_t i = 0; i < max_cargo_stats; i++)
+            {
+                const auto& cargo = station->cargo_stats[i];
+                if (cargo.empty())
+                    continue;
+
+                batch.stations.push_back(station);
+                batch.cargoIndex.push_back(i);
+                batch.quantity.push_back(cargo.quantity);
+                batch.age.push_back(cargo.age);
+                batch.enrouteAge.push_back(cargo.enroute_age);
+                batch.rating.push_back(cargo.rating);
+                // calculateCargoRating only looks at the low byte
+                batch.var36.push_back(static_cast<uint8_t>(cargo.var_36));
+                batch.var38.push_back(cargo.var_38);
+                batch.ageEnroute.push_back(cargo.quantity != 0 && cargo.origin != stationId);
+                batch.fixedRating.push_back(fixedRating);
+            }
+        }
+
+        const auto count = batch.stations.size();
+        for (size_t i = 0; i < count; i++)
+        {
+            batch.enrouteAge[i] = std::min(batch.enrouteAge[i] + batch.ageEnroute[i], 255);
+            batch.age[i] = std::min(batch.age[i] + 1, 255);
+        }
+
+        calculateCargoRatings(count, batch.quantity.data(), batch.age.data(), batch.rating.data(), batch.var36.data(), batch.var38.data(), batch.fixedRating.data());
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto& cargo = batch.stations[i]->cargo_stats[batch.cargoIndex[i]];
+#ifndef NDEBUG
+            cargo.age = batch.age[i];
+            const auto target = batch.stations[i]->calculateCargoRating(cargo);
+            assert(batch.rating[i] == cargo.rating + std::clamp(target - cargo.rating, -2, 2));
+#endif
+            cargo.enroute_age = batch.enrouteAge[i];
+            cargo.age = batch.age[i];
+            cargo.rating = batch.rating[i];
+        }
+    }
+
     // 0x00492793
-    bool Station::updateCargo()
+    bool Station::updateCargo(const bool ratingsUpdated)
     {
         bool atLeastOneGoodRating = false;
         bool quantityUpdated = false;
@@ -578,16 +737,19 @@ namespace OpenLoco
             auto& cargo = cargo_stats[i];
             if (!cargo.empty())
             {
-                if (cargo.quantity != 0 && cargo.origin != id())
+                if (!ratingsUpdated)
                 {
-                    cargo.enroute_age = std::min(cargo.enroute_age + 1, 255);
-                }
-                cargo.age = std::min(cargo.age + 1, 255);
+                    if (cargo.quantity != 0 && cargo.origin != id())
+                    {
+                        cargo.enroute_age = std::min(cargo.enroute_age + 1, 255);
+                    }
+                    cargo.age = std::min(cargo.age + 1, 255);
 
-                auto targetRating = calculateCargoRating(cargo);
-                // Limit to +/- 2 minimum change
-                auto ratingDelta = std::clamp(targetRating - cargo.rating, -2, 2);
-                cargo.rating += ratingDelta;
+                    auto targetRating = calculateCargoRating(cargo);
+                    // Limit to +/- 2 minimum change
+                    auto ratingDelta = std::clamp(targetRating - cargo.rating, -2, 2);
+                    cargo.rating += ratingDelta;
+                }
 
                 if (cargo.rating <= 50)
                 {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Span.hpp"
 #include "LabelFrame.h"
 #include "Localisation/StringManager.h"
 #include "Map/Tile.h"
@@ -104,7 +105,7 @@ namespace OpenLoco
         uint32_t calcAcceptedCargo(CargoSearchState& cargoSearchState, const Pos2& location = { -1, -1 }, const uint32_t filter = 0);
         void sub_48F7D1();
         char* getStatusString(char* buffer);
-        bool updateCargo();
+        bool updateCargo(const bool ratingsUpdated = false);
         int32_t calculateCargoRating(const StationCargoStats& cargo) const;
         void invalidate();
         void invalidateWindow();
@@ -118,4 +119,6 @@ namespace OpenLoco
     };
     static_assert(sizeof(Station) == 0x3D2);
 #pragma pack(pop)
+
+    void updateCargoRatings(stdx::span<Station* const> stations);
 }
@@ -5,6 +5,8 @@
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "Window.h"
+#include <bitset>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui;
@@ -12,11 +14,15 @@ using namespace OpenLoco::Ui;
 namespace OpenLoco::StationManager
 {
     static loco_global<Station[max_stations], 0x005E6EDC> _stations;
+    static ActiveIdList<StationId_t, max_stations> _activeIds;
+    static std::vector<Station*> _ratingStations;
+    static std::bitset<max_stations> _ratingsUpdated;
 
     // 0x0048B1D8
     void reset()
     {
         call(0x0048B1D8);
+        invalidateActiveIds();
     }
 
     std::array<Station, max_stations>& stations()
@@ -35,6 +41,17 @@ namespace OpenLoco::StationManager
         return nullptr;
     }
 
+    // The stations that are in use, in id order
+    ActiveObjectRange<Station, StationId_t> activeStations()
+    {
+        return ActiveObjectRange<Station, StationId_t>(&_stations[0], _activeIds.get(&_stations[0]));
+    }
+
+    void invalidateActiveIds()
+    {
+        _activeIds.invalidate();
+    }
+
     // 0x0048B1FA
     void update()
     {
@@ -81,44 +98,54 @@ namespace OpenLoco::StationManager
     // 0x0048B244
     void updateDaily()
     {
-        for (auto& town : TownManager::towns())
+        for (auto& town : TownManager::activeTowns())
         {
-            if (!town.empty())
-            {
-                town.flags &= ~TownFlags::ratingAdjusted;
-            }
+            town.flags &= ~TownFlags::ratingAdjusted;
         }
 
-        for (auto& station : stations())
+        // Cargo ratings are updated for all stations in one batch up front. The original removal of a
+        // station may touch other stations, so the batch stops at the first station that is about to be
+        // removed and the rest are left to updateCargo.
+        _ratingStations.clear();
+        _ratingsUpdated.reset();
+        for (auto& station : activeStations())
         {
-            if (!station.empty())
+            if (station.stationTileSize == 0 && static_cast<uint8_t>(station.var_29 + 1) >= 10)
+                break;
+
+            _ratingStations.push_back(&station);
+            _ratingsUpdated.set(station.id());
+        }
+        updateCargoRatings(_ratingStations);
+
+        for (auto& station : activeStations())
+        {
+            if (station.stationTileSize == 0)
             {
-                if (station.stationTileSize == 0)
+                station.var_29++;
+                if (station.var_29 != 5 && isPlayerCompany(station.owner))
                 {
-                    station.var_29++;
-                    if (station.var_29 != 5 && isPlayerCompany(station.owner))
-                    {
-                        sub_437F29(station.owner, 8);
-                    }
-                    if (station.var_29 >= 10)
-                    {
-                        sub_49E1F1(station.id());
-                        station.invalidate();
-                        station.sub_48F7D1();
-                    }
+                    sub_437F29(station.owner, 8);
                 }
-                else
+                if (station.var_29 >= 10)
                 {
-                    station.var_29 = 0;
+                    sub_49E1F1(station.id());
+                    station.invalidate();
+                    station.sub_48F7D1();
+                    invalidateActiveIds();
                 }
-                if (station.updateCargo())
+            }
+            else
+            {
+                station.var_29 = 0;
+            }
+            if (station.updateCargo(_ratingsUpdated.test(station.id())))
+            {
+                auto town = TownManager::get(station.town);
+                if (town != nullptr && !(town->flags & TownFlags::ratingAdjusted))
                 {
-                    auto town = TownManager::get(station.town);
-                    if (town != nullptr && !(town->flags & TownFlags::ratingAdjusted))
-                    {
-                        town->flags |= TownFlags::ratingAdjusted;
-                        town->adjustCompanyRating(station.owner, 1);
-                    }
+                    town->flags |= TownFlags::ratingAdjusted;
+                    town->adjustCompanyRating(station.owner, 1);
                 }
             }
         }
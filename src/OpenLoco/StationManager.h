@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/ActiveIdList.hpp"
 #include "Station.h"
 #include <array>
 #include <cstddef>
@@ -11,6 +12,8 @@ namespace OpenLoco::StationManager
     void reset();
     std::array<Station, max_stations>& stations();
     Station* get(StationId_t id);
+    ActiveObjectRange<Station, StationId_t> activeStations();
+    void invalidateActiveIds();
     void update();
     void updateLabels();
     void updateDaily();
@@ -1,6 +1,7 @@
 #include "TownManager.h"
 #include "CompanyManager.h"
 #include "Interop/Interop.hpp"
+#include "MonthlyScheduler.h"
 #include "OpenLoco.h"
 #include "Ui/WindowManager.h"
 #include "Utility/Numeric.hpp"
@@ -10,11 +11,13 @@ using namespace OpenLoco::Interop;
 namespace OpenLoco::TownManager
 {
     static loco_global<Town[max_towns], 0x005B825C> _towns;
+    static ActiveIdList<TownId_t, max_towns> _activeIds;
 
     // 0x00496B38
     void reset()
     {
         call(0x00496B38);
+        invalidateActiveIds();
     }
 
     std::array<Town, max_towns>& towns()
@@ -32,6 +35,17 @@ namespace OpenLoco::TownManager
         return &_towns[id];
     }
 
+    // The towns that are in use, in id order
+    ActiveObjectRange<Town, TownId_t> activeTowns()
+    {
+        return ActiveObjectRange<Town, TownId_t>(&_towns[0], _activeIds.get(&_towns[0]));
+    }
+
+    void invalidateActiveIds()
+    {
+        _activeIds.invalidate();
+    }
+
     // 0x00496B6D
     void update()
     {
@@ -54,79 +68,94 @@ namespace OpenLoco::TownManager
     // 0x0049771C
     void updateLabels()
     {
-        for (Town& town : towns())
+        for (Town& town : activeTowns())
         {
-            if (town.empty())
-                continue;
-
             town.updateLabel();
         }
     }
 
-    // 0x0049748C
-    void updateMonthly()
+    // Part of 0x0049748C, the population history only feeds the town window graph so it is
+    // updated in a slice after the month end
+    static void updateHistory(Town& currTown, const uint32_t population)
     {
-        for (Town& currTown : towns())
+        // Scroll history
+        if (currTown.history_size == std::size(currTown.history))
         {
-            if (currTown.empty())
-                continue;
+            for (size_t i = 0; i < std::size(currTown.history) - 1; i++)
+                currTown.history[i] = currTown.history[i + 1];
+        }
+        else
+            currTown.history_size++;
 
-            // Scroll history
-            if (currTown.history_size == std::size(currTown.history))
-            {
-                for (size_t i = 0; i < std::size(currTown.history) - 1; i++)
-                    currTown.history[i] = currTown.history[i + 1];
-            }
-            else
-                currTown.history_size++;
+        // Compute population growth.
+        uint32_t popSteps = std::max<int32_t>(population - currTown.history_min_population, 0) / 50;
+        uint32_t popGrowth = 0;
+        while (popSteps > 255)
+        {
+            popSteps -= 20;
+            popGrowth += 1000;
+        }
 
-            // Compute population growth.
-            uint32_t popSteps = std::max<int32_t>(currTown.population - currTown.history_min_population, 0) / 50;
-            uint32_t popGrowth = 0;
-            while (popSteps > 255)
-            {
-                popSteps -= 20;
-                popGrowth += 1000;
-            }
+        // Any population growth to account for?
+        if (popGrowth != 0)
+        {
+            currTown.history_min_population += popGrowth;
 
-            // Any population growth to account for?
-            if (popGrowth != 0)
+            uint8_t offset = (popGrowth / 50) & 0xFF;
+            for (uint8_t i = 0; i < currTown.history_size; i++)
             {
-                currTown.history_min_population += popGrowth;
-
-                uint8_t offset = (popGrowth / 50) & 0xFF;
-                for (uint8_t i = 0; i < currTown.history_size; i++)
-                {
-                    int16_t newHistory = currTown.history[i] - offset;
-                    currTown.history[i] = newHistory >= 0 ? static_cast<uint8_t>(newHistory) : 0;
-                }
+                int16_t newHistory = currTown.history[i] - offset;
+                currTown.history[i] = newHistory >= 0 ? static_cast<uint8_t>(newHistory) : 0;
             }
+        }
 
-            // Write new history point.
-            currTown.history[currTown.history_size - 1] = popSteps & 0xFF;
+        // Write new history point.
+        currTown.history[currTown.history_size - 1] = popSteps & 0xFF;
 
-            // Find historical maximum population.
-            uint8_t maxPopulation = 0;
-            for (int i = 0; i < currTown.history_size; i++)
-                maxPopulation = std::max(maxPopulation, currTown.history[i]);
+        // Find historical maximum population.
+        uint8_t maxPopulation = 0;
+        for (int i = 0; i < currTown.history_size; i++)
+            maxPopulation = std::max(maxPopulation, currTown.history[i]);
 
-            int32_t popOffset = currTown.history_min_population;
-            while (maxPopulation <= 235 && popOffset > 0)
-            {
-                maxPopulation += 20;
-                popOffset -= 1000;
-            }
+        int32_t popOffset = currTown.history_min_population;
+        while (maxPopulation <= 235 && popOffset > 0)
+        {
+            maxPopulation += 20;
+            popOffset -= 1000;
+        }
 
-            popOffset -= currTown.history_min_population;
-            if (popOffset != 0)
-            {
-                popOffset = -popOffset;
-                currTown.history_min_population -= popOffset;
-                popOffset /= 50;
+        popOffset -= currTown.history_min_population;
+        if (popOffset != 0)
+        {
+            popOffset = -popOffset;
+            currTown.history_min_population -= popOffset;
+            popOffset /= 50;
 
-                for (int i = 0; i < currTown.history_size; i++)
-                    currTown.history[i] += popOffset;
-            }
+            for (int i = 0; i < currTown.history_size; i++)
+                currTown.history[i] += popOffset;
+        }
+    }
+
+    // 0x0049748C
+    void updateMonthly()
+    {
+        for (Town& currTown : activeTowns())
+        {
+            const auto id = currTown.id();
+            const auto population = currTown.population;
+            // The town may be removed and its slot reused before the slice runs, the name and
+            // position tell the towns apart
+            const auto name = currTown.name;
+            const auto x = currTown.x;
+            const auto y = currTown.y;
+            MonthlyScheduler::enqueue([id, population, name, x, y]() {
+                auto town = get(id);
+                if (town != nullptr && !town->empty() && town->name == name && town->x == x && town->y == y)
+                {
+                    updateHistory(*town, population);
+                    Ui::WindowManager::invalidate(Ui::WindowType::town, id);
+                }
+            });
 
             // Work towards computing new build speed.
             // will be the smallest of the influence cargo delivered to the town
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/ActiveIdList.hpp"
 #include "Town.h"
 #include <array>
 
@@ -10,6 +11,8 @@ namespace OpenLoco::TownManager
     void reset();
     std::array<Town, max_towns>& towns();
     Town* get(TownId_t id);
+    ActiveObjectRange<Town, TownId_t> activeTowns();
+    void invalidateActiveIds();
     void update();
     void updateLabels();
     void updateMonthly();
@@ -176,5 +176,6 @@ namespace OpenLoco::Ui
         InteractionArg rightOver(int16_t x, int16_t y);
 
         std::pair<ViewportInteraction::InteractionArg, Ui::viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, int32_t flags);
+        std::pair<ViewportInteraction::InteractionArg, Ui::viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, int32_t flags, int32_t fallbackFlags);
     }
 }
@@ -804,11 +804,8 @@ namespace OpenLoco::Ui::Dropdown
         for (; index < CompanyManager::max_companies; index++)
         {
             int16_t maxPerformanceIndex = -1;
-            for (const auto& company : CompanyManager::companies())
+            for (const auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 if (companyOrdered[company.id()] & 1)
                     continue;
 
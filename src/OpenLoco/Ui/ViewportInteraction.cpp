@@ -1,5 +1,6 @@
 #include "../CompanyManager.h"
 #include "../Config.h"
+#include "../Core/Optional.hpp"
 #include "../Entities/EntityManager.h"
 #include "../IndustryManager.h"
 #include "../Input.h"
@@ -247,13 +248,8 @@ namespace OpenLoco::Ui::ViewportInteraction
         const auto firstTile = interaction.pos - Map::offsets[index];
         const Map::Pos3 pos = { firstTile.x, firstTile.y, buildingTile->baseZ() };
 
-        for (auto& company : CompanyManager::companies())
+        for (auto& company : CompanyManager::activeCompanies())
         {
-            if (company.empty())
-            {
-                continue;
-            }
-
             if (company.headquarters_x != pos.x || company.headquarters_y != pos.y || company.headquarters_z != pos.z)
             {
                 continue;
@@ -308,19 +304,15 @@ namespace OpenLoco::Ui::ViewportInteraction
             return InteractionArg{};
 
         auto interactionsToInclude = ~(InteractionItemFlags::entity | InteractionItemFlags::townLabel | InteractionItemFlags::stationLabel);
-        auto res = getMapCoordinatesFromPos(tempX, tempY, interactionsToInclude);
-
+        // clang-format off
+        auto fallbackInteractionsToInclude = ~(InteractionItemFlags::entity | InteractionItemFlags::track | InteractionItemFlags::roadAndTram
+            | InteractionItemFlags::headquarterBuilding | InteractionItemFlags::station | InteractionItemFlags::townLabel
+            | InteractionItemFlags::stationLabel | InteractionItemFlags::industry);
+        // clang-format on
+
+        // Both filters are checked against the same paint pass, the fallback is used when no entity is found
+        auto res = getMapCoordinatesFromPos(tempX, tempY, interactionsToInclude, fallbackInteractionsToInclude);
         auto interaction = res.first;
-        if (interaction.type != InteractionItem::entity)
-        {
-            // clang-format off
-            interactionsToInclude = ~(InteractionItemFlags::entity | InteractionItemFlags::track | InteractionItemFlags::roadAndTram
-                | InteractionItemFlags::headquarterBuilding | InteractionItemFlags::station | InteractionItemFlags::townLabel
-                | InteractionItemFlags::stationLabel | InteractionItemFlags::industry);
-            // clang-format on
-            res = getMapCoordinatesFromPos(tempX, tempY, interactionsToInclude);
-            interaction = res.first;
-        }
 
         // TODO: Rework so that getting the interaction arguments and getting the map tooltip format arguments are seperated
         bool success = false;
@@ -376,18 +368,21 @@ namespace OpenLoco::Ui::ViewportInteraction
         Vehicles::VehicleBase* nearestVehicle = nullptr;
         auto targetPosition = viewport->uiToMap({ tempX, tempY });
 
-        for (auto v : EntityManager::VehicleList())
+        static std::vector<EntityBase*> candidates;
+        EntityManager::getVehicleSpritesAt(targetPosition.x, targetPosition.y, candidates);
+        for (auto* entity : candidates)
         {
-            auto train = Vehicles::Vehicle(v);
-            checkAndSetNearestVehicle(nearestDistance, nearestVehicle, *train.veh2, targetPosition);
-            for (auto car : train.cars)
+            auto* vehicle = entity->asVehicle();
+            switch (vehicle->getSubType())
             {
-                for (auto carComponent : car)
-                {
-                    checkAndSetNearestVehicle(nearestDistance, nearestVehicle, *carComponent.front, targetPosition);
-                    checkAndSetNearestVehicle(nearestDistance, nearestVehicle, *carComponent.back, targetPosition);
-                    checkAndSetNearestVehicle(nearestDistance, nearestVehicle, *carComponent.body, targetPosition);
-                }
+                case Vehicles::VehicleThingType::vehicle_2:
+                case Vehicles::VehicleThingType::bogie:
+                case Vehicles::VehicleThingType::body_start:
+                case Vehicles::VehicleThingType::body_continued:
+                    checkAndSetNearestVehicle(nearestDistance, nearestVehicle, *vehicle, targetPosition);
+                    break;
+                default:
+                    break;
             }
         }
 
@@ -447,8 +442,33 @@ namespace OpenLoco::Ui::ViewportInteraction
         return result;
     }
 
+    static InteractionArg getSessionInteraction(Paint::PaintSession& session, const viewport& vp, int32_t flags)
+    {
+        auto interaction = session.getNormalInteractionInfo(flags);
+        if (!(vp.flags & ViewportFlags::station_names_displayed))
+        {
+            if (session.getContext()->zoom_level <= Config::get().station_names_min_scale)
+            {
+                auto stationInteraction = session.getStationNameInteractionInfo(flags);
+                if (stationInteraction.type != InteractionItem::noInteraction)
+                {
+                    interaction = stationInteraction;
+                }
+            }
+        }
+        if (!(vp.flags & ViewportFlags::town_names_displayed))
+        {
+            auto townInteraction = session.getTownNameInteractionInfo(flags);
+            if (townInteraction.type != InteractionItem::noInteraction)
+            {
+                interaction = townInteraction;
+            }
+        }
+        return interaction;
+    }
+
     // 0x00459E54
-    std::pair<ViewportInteraction::InteractionArg, viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, int32_t flags)
+    static std::pair<ViewportInteraction::InteractionArg, viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, int32_t flags, std::optional<int32_t> fallbackFlags)
     {
         static loco_global<uint8_t, 0x0050BF68> _50BF68; // If in get map coords
         static loco_global<Gfx::drawpixelinfo_t, 0x00E0C3E4> _dpi1;
@@ -486,29 +506,26 @@ namespace OpenLoco::Ui::ViewportInteraction
             auto* session = Paint::allocateSession(_dpi2, vp->flags);
             session->generate();
             session->arrangeStructs();
-            interaction = session->getNormalInteractionInfo(flags);
-            if (!(vp->flags & ViewportFlags::station_names_displayed))
+            interaction = getSessionInteraction(*session, *vp, flags);
+            if (fallbackFlags && interaction.type != InteractionItem::entity)
             {
-                if (_dpi2->zoom_level <= Config::get().station_names_min_scale)
-                {
-                    auto stationInteraction = session->getStationNameInteractionInfo(flags);
-                    if (stationInteraction.type != InteractionItem::noInteraction)
-                    {
-                        interaction = stationInteraction;
-                    }
-                }
-            }
-            if (!(vp->flags & ViewportFlags::town_names_displayed))
-            {
-                auto townInteraction = session->getTownNameInteractionInfo(flags);
-                if (townInteraction.type != InteractionItem::noInteraction)
-                {
-                    interaction = townInteraction;
-                }
+                interaction = getSessionInteraction(*session, *vp, *fallbackFlags);
             }
             break;
         }
         _50BF68 = 0;
         return std::make_pair(interaction, chosenV);
     }
+
+    std::pair<ViewportInteraction::InteractionArg, viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, int32_t flags)
+    {
+        return getMapCoordinatesFromPos(screenX, screenY, flags, std::nullopt);
+    }
+
+    // Same as calling getMapCoordinatesFromPos with flags and then, if no entity was found, with
+    // fallbackFlags but only generates the paint structs once.
+    std::pair<ViewportInteraction::InteractionArg, viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, int32_t flags, int32_t fallbackFlags)
+    {
+        return getMapCoordinatesFromPos(screenX, screenY, flags, std::optional<int32_t>(fallbackFlags));
+    }
 }
@@ -143,6 +143,11 @@ namespace OpenLoco::Ui::Windows
         void open(Vehicles::Car& car);
     }
 
+    namespace EntityPoolStats
+    {
+        window* open();
+    }
+
     namespace EditKeyboardShortcut
     {
         window* open(uint8_t shortcutIndex);
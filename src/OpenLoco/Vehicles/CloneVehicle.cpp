@@ -74,10 +74,12 @@ namespace OpenLoco::Vehicles
         }
 
         // Copy orders
-        std::vector<std::shared_ptr<Vehicles::Order>> clonedOrders;
-        for (auto& existingOrders : Vehicles::OrderRingView(existingTrain.head->orderTableOffset))
+        const auto existingOrders = Vehicles::getDecodedOrders(*existingTrain.head);
+        std::vector<Vehicles::OrderValue> clonedOrders;
+        clonedOrders.reserve(existingOrders.size());
+        for (auto& existingOrder : existingOrders)
         {
-            clonedOrders.push_back(existingOrders.clone());
+            clonedOrders.push_back(existingOrder.order);
         }
 
         for (auto& order : clonedOrders)
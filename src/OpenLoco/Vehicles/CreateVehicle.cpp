@@ -478,6 +478,7 @@ namespace OpenLoco::Vehicles
         newHead->var_38 = 0;
         newHead->var_3C = 0;
         newHead->vehicleType = vehicleType;
+        CompanyManager::incrementTransportCount(newHead->owner, newHead->vehicleType);
         newHead->name = static_cast<uint8_t>(vehicleType) + 4;
         newHead->ordinalNumber = 0; // Reset to null value so ignored in next function
         newHead->ordinalNumber = createUniqueTypeNumber(vehicleType);
@@ -702,7 +703,7 @@ namespace OpenLoco::Vehicles
     {
         sub_4AF7A4(head);
         auto company = CompanyManager::get(_updating_company_id);
-        company->recalculateTransportCounts();
+        company->updateTransportCounts();
 
         if (_backupVeh0 != reinterpret_cast<VehicleHead*>(-1))
         {
@@ -1,10 +1,15 @@
 #include "Orders.h"
+#include "../Entities/EntityManager.h"
 #include "../Interop/Interop.hpp"
 #include "../Localisation/FormatArguments.hpp"
 #include "../Map/Tile.h"
 #include "../Objects/CargoObject.h"
 #include "../Objects/ObjectManager.h"
 #include "../StationManager.h"
+#include "Vehicle.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -38,31 +43,14 @@ namespace OpenLoco::Vehicles
         return _orderFlags[static_cast<uint8_t>(getType())] & flag;
     }
 
-    template<typename T>
-    std::shared_ptr<Order> orderClone(const Order& order)
+    OrderValue::OrderValue(const Order& order)
     {
-        auto* o = order.as<T>();
-        return o != nullptr ? std::make_shared<T>(*o) : nullptr;
+        std::memcpy(_data, &order, _orderSizes[static_cast<uint8_t>(order.getType())]);
     }
 
-    std::shared_ptr<Order> Order::clone() const
+    OrderValue Order::copy() const
     {
-        switch (getType())
-        {
-            case OrderType::End:
-                return orderClone<OrderEnd>(*this);
-            case OrderType::StopAt:
-                return orderClone<OrderStopAt>(*this);
-            case OrderType::RouteThrough:
-                return orderClone<OrderRouteThrough>(*this);
-            case OrderType::RouteWaypoint:
-                return orderClone<OrderRouteWaypoint>(*this);
-            case OrderType::UnloadAll:
-                return orderClone<OrderUnloadAll>(*this);
-            case OrderType::WaitFor:
-                return orderClone<OrderWaitFor>(*this);
-        }
-        return {};
+        return OrderValue(*this);
     }
 
     void OrderRouteWaypoint::setWaypoint(const Map::TilePos2& pos, const uint8_t baseZ)
@@ -207,9 +195,80 @@ namespace OpenLoco::Vehicles
         return begin();
     }
 
+    struct DecodedOrderCache
+    {
+        uint32_t generation = 0;
+        uint32_t tableOffset = 0;
+        uint16_t tableSize = 0;
+        std::vector<DecodedOrder> orders;
+    };
+
+    static std::vector<DecodedOrderCache> _decodedOrderCaches;
+    // Bumped whenever orders may have been inserted, removed or moved. Zero is never a valid generation.
+    static uint32_t _orderCacheGeneration = 1;
+
+    static void decodeOrders(DecodedOrderCache& cache, const VehicleHead& head)
+    {
+        cache.orders.clear();
+        cache.generation = _orderCacheGeneration;
+        cache.tableOffset = head.orderTableOffset;
+        cache.tableSize = head.sizeOfOrderTable;
+
+        uint32_t offset = 0;
+        while (offset < head.sizeOfOrderTable && head.orderTableOffset + offset < max_orders)
+        {
+            const auto& order = _orderTable[head.orderTableOffset + offset];
+            if (order.getType() == OrderType::End)
+            {
+                break;
+            }
+            cache.orders.push_back({ order.copy(), static_cast<uint16_t>(offset) });
+            offset += _orderSizes[static_cast<uint8_t>(order.getType())];
+        }
+    }
+
+    stdx::span<const DecodedOrder> getDecodedOrders(const VehicleHead& head)
+    {
+        if (_decodedOrderCaches.empty())
+        {
+            _decodedOrderCaches.resize(EntityManager::maxEntities);
+        }
+        if (head.id >= _decodedOrderCaches.size())
+        {
+            return {};
+        }
+
+        auto& cache = _decodedOrderCaches[head.id];
+        if (cache.generation != _orderCacheGeneration || cache.tableOffset != head.orderTableOffset || cache.tableSize != head.sizeOfOrderTable)
+        {
+            decodeOrders(cache, head);
+        }
+        return stdx::span<const DecodedOrder>(cache.orders.data(), cache.orders.size());
+    }
+
+    size_t findDecodedOrder(stdx::span<const DecodedOrder> orders, uint16_t offset)
+    {
+        auto it = std::lower_bound(orders.begin(), orders.end(), offset, [](const DecodedOrder& order, uint16_t value) { return order.offset < value; });
+        if (it == orders.end() || it->offset != offset)
+        {
+            return orders.size();
+        }
+        return std::distance(orders.begin(), it);
+    }
+
+    void invalidateOrderCache()
+    {
+        _orderCacheGeneration++;
+        if (_orderCacheGeneration == 0)
+        {
+            _orderCacheGeneration = 1;
+        }
+    }
+
     // 0x004702F7
     void zeroOrderTable()
     {
         call(0x004702F7);
+        invalidateOrderCache();
     }
 }
@@ -1,11 +1,14 @@
 #pragma once
+#include "../Core/Span.hpp"
 #include "../Map/Tile.h"
 #include "../Types.hpp"
 #include <iterator>
-#include <memory>
 
 namespace OpenLoco::Vehicles
 {
+    struct VehicleHead;
+    struct OrderValue;
+
     enum class OrderType : uint8_t
     {
         End,
@@ -40,7 +43,7 @@ namespace OpenLoco::Vehicles
             _type |= static_cast<uint8_t>(type);
         }
         uint32_t getOffset() const;
-        std::shared_ptr<Order> clone() const;
+        OrderValue copy() const;
         uint64_t getRaw() const;
         bool hasFlag(const uint8_t flag) const;
 
@@ -156,8 +159,34 @@ namespace OpenLoco::Vehicles
         }
     };
 
+    // A copy of a single order that is held by value (no heap allocation) and
+    // can be passed back to the order game commands via getRaw.
+    struct OrderValue
+    {
+    private:
+        uint8_t _data[6] = { 0 }; // 0x0 - 0x6 large enough for any order
+
+    public:
+        OrderValue() = default;
+        OrderValue(const Order& order);
+
+        Order& get() { return *reinterpret_cast<Order*>(_data); }
+        const Order& get() const { return *reinterpret_cast<const Order*>(_data); }
+        Order& operator*() { return get(); }
+        const Order& operator*() const { return get(); }
+        Order* operator->() { return &get(); }
+        const Order* operator->() const { return &get(); }
+    };
+    static_assert(sizeof(OrderValue) == sizeof(OrderRouteWaypoint), "OrderValue must fit the largest order");
+
 #pragma pack(pop)
 
+    struct DecodedOrder
+    {
+        OrderValue order;
+        uint16_t offset; // relative to the vehicle's orderTableOffset
+    };
+
     struct OrderRingView
     {
     private:
@@ -244,5 +273,12 @@ namespace OpenLoco::Vehicles
         Order* atIndex(const uint8_t index) const;
     };
 
+    // Returns the orders of the vehicle decoded from the order table. The result is
+    // cached per vehicle and is only valid until the orders of any vehicle change.
+    stdx::span<const DecodedOrder> getDecodedOrders(const VehicleHead& head);
+    // Returns the index of the order at offset (relative to orderTableOffset) or orders.size()
+    size_t findDecodedOrder(stdx::span<const DecodedOrder> orders, uint16_t offset);
+    void invalidateOrderCache();
+
     void zeroOrderTable();
 }
@@ -85,7 +85,7 @@ namespace OpenLoco::Vehicles
         call(0x004AA464, regs);
     }
 
-    bool VehicleBase::updateComponent()
+    bool VehicleBase::updateComponent(UpdateContext& ctx)
     {
         int32_t result = 0;
         registers regs;
@@ -93,22 +93,30 @@ namespace OpenLoco::Vehicles
         switch (getSubType())
         {
             case VehicleThingType::head:
-                return !asVehicleHead()->update();
+            {
+                auto continueUpdating = asVehicleHead()->update(ctx);
+                ctx.sync();
+                return !continueUpdating;
+            }
             case VehicleThingType::vehicle_1:
                 result = call(0x004A9788, regs);
+                ctx.sync();
                 break;
             case VehicleThingType::vehicle_2:
                 result = call(0x004A9B0B, regs);
+                ctx.sync();
                 break;
             case VehicleThingType::bogie:
                 result = call(0x004AA008, regs);
+                ctx.sync();
                 break;
             case VehicleThingType::body_start:
             case VehicleThingType::body_continued:
-                result = asVehicleBody()->update();
+                result = asVehicleBody()->update(ctx);
                 break;
             case VehicleThingType::tail:
                 result = call(0x004AA24A, regs);
+                ctx.sync();
                 break;
             default:
                 break;
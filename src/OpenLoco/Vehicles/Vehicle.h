@@ -68,6 +68,7 @@ namespace OpenLoco::Vehicles
     struct VehicleTail;
 
     struct Vehicle2or6;
+    struct Vehicle;
 
     namespace Flags5F
     {
@@ -98,6 +99,28 @@ namespace OpenLoco::Vehicles
 
     constexpr uint8_t cAirportMovementNodeNull = 0xFF;
 
+    // State shared by the components of a train while it is being updated. This replaces the
+    // vehicleUpdate_* globals on the C++ update path; publish/sync mirror it to those globals
+    // for the component updates that are still called through interop.
+    struct UpdateContext
+    {
+        VehicleHead* head = nullptr;
+        Vehicle1* veh1 = nullptr;
+        Vehicle2* veh2 = nullptr;
+        VehicleTail* tail = nullptr;
+        VehicleBogie* frontBogie = nullptr;
+        VehicleBogie* backBogie = nullptr;
+        int32_t var_113612C = 0; // Speed
+        int32_t var_1136130 = 0; // Speed
+        Status initialStatus{};
+        uint32_t manhattanDistanceToStation = 0; // Aircraft only
+        uint8_t helicopterTargetYaw = 0;         // Aircraft only
+        bool drivingSoundsUpdated = false; // Set when the driving sounds were computed by the pre-pass
+
+        void publish() const;
+        void sync();
+    };
+
 #pragma pack(push, 1)
     struct VehicleBase : EntityBase
     {
@@ -167,7 +190,7 @@ namespace OpenLoco::Vehicles
 
         VehicleBase* nextVehicle();
         VehicleBase* nextVehicleComponent();
-        bool updateComponent();
+        bool updateComponent(UpdateContext& ctx);
         void sub_4AA464();
     };
 
@@ -249,8 +272,9 @@ namespace OpenLoco::Vehicles
     public:
         bool isVehicleTypeCompatible(const uint16_t vehicleTypeId);
         void updateBreakdown();
-        void updateVehicle();
-        bool update();
+        void updateVehicle(bool drivingSoundsUpdated = false);
+        bool update(UpdateContext& ctx);
+        void updateDrivingSounds();
         VehicleStatus getStatus() const;
         OrderRingView getCurrentOrders() const;
         bool isPlaced() const { return tile_x != -1 && !(var_38 & Flags38::isGhost); }
@@ -261,52 +285,51 @@ namespace OpenLoco::Vehicles
 
     private:
         void applyBreakdownToTrain();
-        void updateDrivingSounds();
-        void updateDrivingSound(Vehicle2or6* vehType2or6);
+        void updateDrivingSound(const Vehicle& train, Vehicle2or6* vehType2or6);
         void updateDrivingSoundNone(Vehicle2or6* vehType2or6);
-        void updateDrivingSoundFriction(Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd);
-        void updateDrivingSoundEngine1(Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd);
-        void updateDrivingSoundEngine2(Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd);
+        void updateDrivingSoundFriction(const Vehicle& train, Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd);
+        void updateDrivingSoundEngine1(const Vehicle& train, Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd);
+        void updateDrivingSoundEngine2(const Vehicle& train, Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd);
         void removeDanglingTrain();
-        bool updateLand();
-        bool sub_4A8DB7();
-        bool sub_4A8F22();
-        bool sub_4A8CB6();
-        bool sub_4A8C81();
-        bool landTryBeginUnloading();
-        bool landLoadingUpdate();
-        bool landNormalMovementUpdate();
-        bool trainNormalMovementUpdate(uint8_t al, uint8_t flags, StationId_t nextStation);
-        bool roadNormalMovementUpdate(uint8_t al, StationId_t nextStation);
-        bool landReverseFromSignal();
-        bool updateAir();
-        bool airplaneLoadingUpdate();
-        bool sub_4A95CB();
-        bool sub_4A9348(uint8_t newMovementEdge, uint16_t targetZ);
-        bool airplaneApproachTarget(uint16_t targetZ);
+        bool updateLand(UpdateContext& ctx);
+        bool sub_4A8DB7(UpdateContext& ctx);
+        bool sub_4A8F22(UpdateContext& ctx);
+        bool sub_4A8CB6(UpdateContext& ctx);
+        bool sub_4A8C81(UpdateContext& ctx);
+        bool landTryBeginUnloading(UpdateContext& ctx);
+        bool landLoadingUpdate(UpdateContext& ctx);
+        bool landNormalMovementUpdate(UpdateContext& ctx);
+        bool trainNormalMovementUpdate(UpdateContext& ctx, uint8_t al, uint8_t flags, StationId_t nextStation);
+        bool roadNormalMovementUpdate(UpdateContext& ctx, uint8_t al, StationId_t nextStation);
+        bool landReverseFromSignal(UpdateContext& ctx);
+        bool updateAir(UpdateContext& ctx);
+        bool airplaneLoadingUpdate(UpdateContext& ctx);
+        bool sub_4A95CB(UpdateContext& ctx);
+        bool sub_4A9348(UpdateContext& ctx, uint8_t newMovementEdge, uint16_t targetZ);
+        bool airplaneApproachTarget(UpdateContext& ctx, uint16_t targetZ);
         std::pair<Status, Speed16> airplaneGetNewStatus();
         uint8_t airportGetNextMovementEdge(uint8_t curEdge);
         std::tuple<uint32_t, uint16_t, uint8_t> sub_427122();
         std::pair<uint32_t, Map::Pos3> airportGetMovementEdgeTarget(StationId_t targetStation, uint8_t curEdge);
-        bool updateWater();
+        bool updateWater(UpdateContext& ctx);
         uint32_t getVehicleTotalLength();
-        void tryCreateInitialMovementSound();
+        void tryCreateInitialMovementSound(const UpdateContext& ctx);
         void setStationVisitedTypes();
         void checkIfAtOrderStation();
         void updateLastJourneyAverageSpeed();
         void beginUnloading();
         void movePlaneTo(const Map::Pos3& newLoc, const uint8_t newYaw, const Pitch newPitch);
-        uint32_t updateWaterMotion(uint32_t flags);
+        uint32_t updateWaterMotion(UpdateContext& ctx, uint32_t flags);
         void moveBoatTo(const Map::Pos3& loc, const uint8_t yaw, const Pitch pitch);
         bool updateUnloadCargoComponent(VehicleCargo& cargo, VehicleBogie* bogie);
-        void updateUnloadCargo();
+        void updateUnloadCargo(const UpdateContext& ctx);
         bool updateLoadCargo();
         void beginNewJourney();
         void advanceToNextRoutableOrder();
         Status sub_427BF2();
-        void produceLeavingDockSound();
+        void produceLeavingDockSound(const UpdateContext& ctx);
         std::tuple<StationId_t, Map::Pos2, Map::Pos3> sub_427FC9();
-        void produceTouchdownAirportSound();
+        void produceTouchdownAirportSound(const UpdateContext& ctx);
         uint8_t sub_4AA36A();
         void sub_4AD778();
         void sub_4AA625();
@@ -449,20 +472,20 @@ namespace OpenLoco::Vehicles
         uint8_t var_5F;
 
         VehicleObject* object() const;
-        int32_t update();
-        void secondaryAnimationUpdate();
-        void sub_4AAB0B();
+        int32_t update(const UpdateContext& ctx);
+        void secondaryAnimationUpdate(const UpdateContext& ctx);
+        void sub_4AAB0B(const UpdateContext& ctx);
         void updateCargoSprite();
 
     private:
-        void animationUpdate();
+        void animationUpdate(const UpdateContext& ctx);
         void sub_4AC255(VehicleBogie* back_bogie, VehicleBogie* front_bogie);
-        void steamPuffsAnimationUpdate(uint8_t num, int32_t var_05);
-        void dieselExhaust1AnimationUpdate(uint8_t num, int32_t var_05);
-        void dieselExhaust2AnimationUpdate(uint8_t num, int32_t var_05);
-        void electricSpark1AnimationUpdate(uint8_t num, int32_t var_05);
-        void electricSpark2AnimationUpdate(uint8_t num, int32_t var_05);
-        void shipWakeAnimationUpdate(uint8_t num, int32_t var_05);
+        void steamPuffsAnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05);
+        void dieselExhaust1AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05);
+        void dieselExhaust2AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05);
+        void electricSpark1AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05);
+        void electricSpark2AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05);
+        void shipWakeAnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05);
         Pitch updateSpritePitchSteepSlopes(uint16_t xy_offset, int16_t z_offset);
         Pitch updateSpritePitch(uint16_t xy_offset, int16_t z_offset);
     };
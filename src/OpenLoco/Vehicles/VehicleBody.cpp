@@ -16,12 +16,6 @@ using namespace OpenLoco::Literals;
 
 namespace OpenLoco::Vehicles
 {
-
-    static loco_global<VehicleHead*, 0x01136118> vehicleUpdate_head;
-    static loco_global<Vehicle2*, 0x01136120> vehicleUpdate_2;
-    static loco_global<VehicleBogie*, 0x01136124> vehicleUpdate_frontBogie;
-    static loco_global<VehicleBogie*, 0x01136128> vehicleUpdate_backBogie;
-    static loco_global<int32_t, 0x01136130> vehicleUpdate_var_1136130; // Speed
     static loco_global<uint8_t, 0x01136237> vehicle_var_1136237;       // var_28 related?
     static loco_global<uint8_t, 0x01136238> vehicle_var_1136238;       // var_28 related?
     static loco_global<int8_t[88], 0x004F865C> vehicle_arr_4F865C;     // var_2C related?
@@ -48,24 +42,22 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004AA1D0
-    int32_t VehicleBody::update()
+    int32_t VehicleBody::update(const UpdateContext& ctx)
     {
-        registers regs;
-        regs.esi = (int32_t)this;
-
         if (mode == TransportMode::air || mode == TransportMode::water)
         {
-            animationUpdate();
+            animationUpdate(ctx);
             return 0;
         }
 
         if (vehicle_var_1136237 | vehicle_var_1136238)
         {
             invalidateSprite();
-            sub_4AC255(vehicleUpdate_backBogie, vehicleUpdate_frontBogie);
+            sub_4AC255(ctx.backBogie, ctx.frontBogie);
             invalidateSprite();
         }
-        uint32_t backup1136130 = vehicleUpdate_var_1136130;
+        // The body animates with its own speed without affecting the rest of the train
+        UpdateContext bodyCtx = ctx;
         if (var_5E != 0)
         {
             int32_t var_1136130 = var_5E;
@@ -74,21 +66,20 @@ namespace OpenLoco::Vehicles
                 var_1136130 = 64 - var_1136130;
             }
 
-            vehicleUpdate_var_1136130 += var_1136130 * 320 + 500;
+            bodyCtx.var_1136130 += var_1136130 * 320 + 500;
         }
-        animationUpdate();
-        sub_4AAB0B();
-        vehicleUpdate_var_1136130 = backup1136130;
+        animationUpdate(bodyCtx);
+        sub_4AAB0B(bodyCtx);
         return 0;
     }
 
     // 0x004AAC4E
-    void VehicleBody::animationUpdate()
+    void VehicleBody::animationUpdate(const UpdateContext& ctx)
     {
         if (var_38 & Flags38::isGhost)
             return;
 
-        VehicleHead* headVeh = vehicleUpdate_head;
+        VehicleHead* headVeh = ctx.head;
         if ((headVeh->status == Status::crashed) || (headVeh->status == Status::stuck))
             return;
 
@@ -108,34 +99,34 @@ namespace OpenLoco::Vehicles
             case simple_animation_type::steam_puff1:
             case simple_animation_type::steam_puff2:
             case simple_animation_type::steam_puff3:
-                steamPuffsAnimationUpdate(0, var_05);
+                steamPuffsAnimationUpdate(ctx, 0, var_05);
                 break;
             case simple_animation_type::diesel_exhaust1:
-                dieselExhaust1AnimationUpdate(0, var_05);
+                dieselExhaust1AnimationUpdate(ctx, 0, var_05);
                 break;
             case simple_animation_type::electric_spark1:
-                electricSpark1AnimationUpdate(0, var_05);
+                electricSpark1AnimationUpdate(ctx, 0, var_05);
                 break;
             case simple_animation_type::electric_spark2:
-                electricSpark2AnimationUpdate(0, var_05);
+                electricSpark2AnimationUpdate(ctx, 0, var_05);
                 break;
             case simple_animation_type::diesel_exhaust2:
-                dieselExhaust2AnimationUpdate(0, var_05);
+                dieselExhaust2AnimationUpdate(ctx, 0, var_05);
                 break;
             case simple_animation_type::ship_wake:
-                shipWakeAnimationUpdate(0, var_05);
+                shipWakeAnimationUpdate(ctx, 0, var_05);
                 break;
             default:
                 assert(false);
                 break;
         }
-        secondaryAnimationUpdate();
+        secondaryAnimationUpdate(ctx);
     }
 
     // 0x004AAB0B
-    void VehicleBody::sub_4AAB0B()
+    void VehicleBody::sub_4AAB0B(const UpdateContext& ctx)
     {
-        int32_t eax = vehicleUpdate_var_1136130 >> 3;
+        int32_t eax = ctx.var_1136130 >> 3;
         if (var_38 & Flags38::isReversed)
         {
             eax = -eax;
@@ -149,14 +140,14 @@ namespace OpenLoco::Vehicles
         uint8_t al = 0;
         if (vehicleObj->bodySprites[object_sprite_type].flags & BodySpriteFlags::hasSpeedAnimation)
         {
-            Vehicle2* veh3 = vehicleUpdate_2;
+            Vehicle2* veh3 = ctx.veh2;
             al = veh3->currentSpeed / (vehicleObj->speed / vehicleObj->bodySprites[object_sprite_type].numAnimationFrames);
             al = std::min<uint8_t>(al, vehicleObj->bodySprites[object_sprite_type].numAnimationFrames - 1);
         }
         else if (vehicleObj->bodySprites[object_sprite_type].numRollFrames != 1)
         {
-            VehicleBogie* frontBogie = vehicleUpdate_frontBogie;
-            Vehicle2* veh3 = vehicleUpdate_2;
+            VehicleBogie* frontBogie = ctx.frontBogie;
+            Vehicle2* veh3 = ctx.veh2;
             al = var_46;
             int8_t ah = 0;
             if (veh3->currentSpeed < 35.0_mph)
@@ -859,7 +850,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004AB655
-    void VehicleBody::secondaryAnimationUpdate()
+    void VehicleBody::secondaryAnimationUpdate(const UpdateContext& ctx)
     {
         auto vehicleObject = object();
 
@@ -876,22 +867,22 @@ namespace OpenLoco::Vehicles
             case simple_animation_type::steam_puff1:
             case simple_animation_type::steam_puff2:
             case simple_animation_type::steam_puff3:
-                steamPuffsAnimationUpdate(1, var_05);
+                steamPuffsAnimationUpdate(ctx, 1, var_05);
                 break;
             case simple_animation_type::diesel_exhaust1:
-                dieselExhaust1AnimationUpdate(1, var_05);
+                dieselExhaust1AnimationUpdate(ctx, 1, var_05);
                 break;
             case simple_animation_type::electric_spark1:
-                electricSpark1AnimationUpdate(1, var_05);
+                electricSpark1AnimationUpdate(ctx, 1, var_05);
                 break;
             case simple_animation_type::electric_spark2:
-                electricSpark2AnimationUpdate(1, var_05);
+                electricSpark2AnimationUpdate(ctx, 1, var_05);
                 break;
             case simple_animation_type::diesel_exhaust2:
-                dieselExhaust2AnimationUpdate(1, var_05);
+                dieselExhaust2AnimationUpdate(ctx, 1, var_05);
                 break;
             case simple_animation_type::ship_wake:
-                shipWakeAnimationUpdate(1, var_05);
+                shipWakeAnimationUpdate(ctx, 1, var_05);
                 break;
             default:
                 assert(false);
@@ -900,15 +891,15 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004AB688, 0x004AACA5
-    void VehicleBody::steamPuffsAnimationUpdate(uint8_t num, int32_t var_05)
+    void VehicleBody::steamPuffsAnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05)
     {
         auto vehicleObject = object();
-        VehicleBogie* frontBogie = vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = ctx.frontBogie;
+        VehicleBogie* backBogie = ctx.backBogie;
         if (frontBogie->var_5F & Flags5F::broken_down)
             return;
 
-        Vehicle2* veh_2 = vehicleUpdate_2;
+        Vehicle2* veh_2 = ctx.veh2;
         bool soundCode = false;
         if (veh_2->var_5A == 1 || veh_2->var_5A == 4)
         {
@@ -935,7 +926,7 @@ namespace OpenLoco::Vehicles
         }
         else
         {
-            if (vehicleUpdate_var_1136130 + (uint16_t)(_var_44 * 8) < std::numeric_limits<uint16_t>::max())
+            if (ctx.var_1136130 + (uint16_t)(_var_44 * 8) < std::numeric_limits<uint16_t>::max())
             {
                 return;
             }
@@ -1044,15 +1035,15 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004AB9DD & 0x004AAFFA
-    void VehicleBody::dieselExhaust1AnimationUpdate(uint8_t num, int32_t var_05)
+    void VehicleBody::dieselExhaust1AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05)
     {
-        VehicleBogie* frontBogie = vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = ctx.frontBogie;
+        VehicleBogie* backBogie = ctx.backBogie;
         if (frontBogie->var_5F & Flags5F::broken_down)
             return;
 
-        VehicleHead* headVeh = vehicleUpdate_head;
-        Vehicle2* veh_2 = vehicleUpdate_2;
+        VehicleHead* headVeh = ctx.head;
+        Vehicle2* veh_2 = ctx.veh2;
         auto vehicleObject = object();
 
         if (headVeh->vehicleType == VehicleType::ship)
@@ -1102,14 +1093,14 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004ABB5A & 0x004AB177
-    void VehicleBody::dieselExhaust2AnimationUpdate(uint8_t num, int32_t var_05)
+    void VehicleBody::dieselExhaust2AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05)
     {
-        VehicleBogie* frontBogie = vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = ctx.frontBogie;
+        VehicleBogie* backBogie = ctx.backBogie;
         if (frontBogie->var_5F & Flags5F::broken_down)
             return;
 
-        Vehicle2* veh_2 = vehicleUpdate_2;
+        Vehicle2* veh_2 = ctx.veh2;
         auto vehicleObject = object();
 
         if (veh_2->var_5A != 1)
@@ -1150,14 +1141,14 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004ABDAD & 0x004AB3CA
-    void VehicleBody::electricSpark1AnimationUpdate(uint8_t num, int32_t var_05)
+    void VehicleBody::electricSpark1AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05)
     {
-        VehicleBogie* frontBogie = vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = ctx.frontBogie;
+        VehicleBogie* backBogie = ctx.backBogie;
         if (frontBogie->var_5F & Flags5F::broken_down)
             return;
 
-        Vehicle2* veh_2 = vehicleUpdate_2;
+        Vehicle2* veh_2 = ctx.veh2;
         auto vehicleObject = object();
 
         if (veh_2->var_5A != 2 && veh_2->var_5A != 1)
@@ -1170,7 +1161,7 @@ namespace OpenLoco::Vehicles
             _var_44 = -var_44;
         }
 
-        if (((uint16_t)vehicleUpdate_var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
+        if (((uint16_t)ctx.var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
             return;
 
         var_05 += 64;
@@ -1187,14 +1178,14 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004ABEC3 & 0x004AB4E0
-    void VehicleBody::electricSpark2AnimationUpdate(uint8_t num, int32_t var_05)
+    void VehicleBody::electricSpark2AnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t var_05)
     {
-        VehicleBogie* frontBogie = vehicleUpdate_frontBogie;
-        VehicleBogie* backBogie = vehicleUpdate_backBogie;
+        VehicleBogie* frontBogie = ctx.frontBogie;
+        VehicleBogie* backBogie = ctx.backBogie;
         if (frontBogie->var_5F & Flags5F::broken_down)
             return;
 
-        Vehicle2* veh_2 = vehicleUpdate_2;
+        Vehicle2* veh_2 = ctx.veh2;
         auto vehicleObject = object();
 
         if (veh_2->var_5A != 2 && veh_2->var_5A != 1)
@@ -1207,7 +1198,7 @@ namespace OpenLoco::Vehicles
             _var_44 = -var_44;
         }
 
-        if (((uint16_t)vehicleUpdate_var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
+        if (((uint16_t)ctx.var_1136130) + ((uint16_t)_var_44 * 8) < std::numeric_limits<uint16_t>::max())
             return;
 
         var_05 += 64;
@@ -1242,9 +1233,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004ABC8A & 0x004AB2A7
-    void VehicleBody::shipWakeAnimationUpdate(uint8_t num, int32_t)
+    void VehicleBody::shipWakeAnimationUpdate(const UpdateContext& ctx, uint8_t num, int32_t)
     {
-        Vehicle2* veh_2 = vehicleUpdate_2;
+        Vehicle2* veh_2 = ctx.veh2;
         auto vehicleObject = object();
 
         if (veh_2->var_5A == 0)
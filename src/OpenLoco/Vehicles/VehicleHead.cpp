@@ -28,6 +28,7 @@
 #include "../ViewportManager.h"
 #include "Orders.h"
 #include "Vehicle.h"
+#include "VehicleManager.h"
 #include <cassert>
 
 using namespace OpenLoco::Interop;
@@ -54,13 +55,83 @@ namespace OpenLoco::Vehicles
     static constexpr uint16_t busSignalTimeout = 960;   // Time to wait before turning around at barriers
     static constexpr uint16_t tramSignalTimeout = 2880; // Time to wait before turning around at barriers
 
-    void VehicleHead::updateVehicle()
+    namespace
     {
+        // Airport station element of a station. The element is copied rather than pointed to as
+        // the tile element defragmenter may move it.
+        struct AirportElementInfo
+        {
+            Map::Pos3 loc;
+            uint8_t objectId;
+            uint8_t rotation;
+        };
+    }
+
+    // Finds the station element at the station's airport tile (unk_tile_x/y/z)
+    static std::optional<AirportElementInfo> getAirportElement(const StationId_t stationId)
+    {
+        auto station = StationManager::get(stationId);
+        const Pos3 loc = {
+            station->unk_tile_x,
+            station->unk_tile_y,
+            station->unk_tile_z
+        };
+
+        auto tile = TileManager::get(loc);
+        for (auto& el : tile)
+        {
+            auto elStation = el.asStation();
+            if (elStation == nullptr)
+                continue;
+
+            if (elStation->baseZ() != loc.z / 4)
+                continue;
+
+            return AirportElementInfo{ loc, elStation->objectId(), elStation->rotation() };
+        }
+        return std::nullopt;
+    }
+
+    void UpdateContext::publish() const
+    {
+        vehicleUpdate_head = head;
+        vehicleUpdate_1 = veh1;
+        vehicleUpdate_2 = veh2;
+        vehicleUpdate_frontBogie = frontBogie;
+        vehicleUpdate_backBogie = backBogie;
+        vehicleUpdate_var_113612C = var_113612C;
+        vehicleUpdate_var_1136130 = var_1136130;
+        vehicleUpdate_initialStatus = initialStatus;
+        vehicleUpdate_manhattanDistanceToStation = manhattanDistanceToStation;
+        vehicleUpdate_helicopterTargetYaw = helicopterTargetYaw;
+    }
+
+    void UpdateContext::sync()
+    {
+        head = vehicleUpdate_head;
+        veh1 = vehicleUpdate_1;
+        veh2 = vehicleUpdate_2;
+        frontBogie = vehicleUpdate_frontBogie;
+        backBogie = vehicleUpdate_backBogie;
+        var_113612C = vehicleUpdate_var_113612C;
+        var_1136130 = vehicleUpdate_var_1136130;
+        initialStatus = vehicleUpdate_initialStatus;
+        manhattanDistanceToStation = vehicleUpdate_manhattanDistanceToStation;
+        helicopterTargetYaw = vehicleUpdate_helicopterTargetYaw;
+    }
+
+    void VehicleHead::updateVehicle(bool drivingSoundsUpdated)
+    {
+        // Start from the interop state so that values not set by this train carry over as before
+        UpdateContext ctx;
+        ctx.sync();
+        ctx.drivingSoundsUpdated = drivingSoundsUpdated;
+
         // TODO: Refactor to use the Vehicle super class
         VehicleBase* v = this;
         while (v != nullptr)
         {
-            if (v->updateComponent())
+            if (v->updateComponent(ctx))
             {
                 break;
             }
@@ -69,22 +140,27 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8B81
-    bool VehicleHead::update()
+    bool VehicleHead::update(UpdateContext& ctx)
     {
         Vehicle train(this);
-        vehicleUpdate_head = train.head;
-        vehicleUpdate_1 = train.veh1;
-        vehicleUpdate_2 = train.veh2;
+        ctx.head = train.head;
+        ctx.veh1 = train.veh1;
+        ctx.veh2 = train.veh2;
+        ctx.tail = train.tail;
 
-        vehicleUpdate_initialStatus = status;
-        updateDrivingSounds();
+        ctx.initialStatus = status;
+        if (!ctx.drivingSoundsUpdated || VehicleManager::restoreStaleDrivingSounds(*this))
+        {
+            updateDrivingSound(train, train.veh2->asVehicle2Or6());
+            updateDrivingSound(train, train.tail->asVehicle2Or6());
+        }
 
-        vehicleUpdate_frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
-        vehicleUpdate_backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        ctx.frontBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
+        ctx.backBogie = reinterpret_cast<VehicleBogie*>(0xFFFFFFFF);
 
-        Vehicle2* veh2 = vehicleUpdate_2;
-        vehicleUpdate_var_113612C = veh2->currentSpeed.getRaw() >> 7;
-        vehicleUpdate_var_1136130 = veh2->currentSpeed.getRaw() >> 7;
+        ctx.var_113612C = ctx.veh2->currentSpeed.getRaw() >> 7;
+        ctx.var_1136130 = ctx.veh2->currentSpeed.getRaw() >> 7;
+        ctx.publish();
 
         if (var_5C != 0)
         {
@@ -112,27 +188,27 @@ namespace OpenLoco::Vehicles
         {
             case TransportMode::rail:
             case TransportMode::road:
-                continueUpdating = updateLand();
+                continueUpdating = updateLand(ctx);
                 break;
             case TransportMode::air:
-                continueUpdating = updateAir();
+                continueUpdating = updateAir(ctx);
                 if (continueUpdating)
                 {
-                    tryCreateInitialMovementSound();
+                    tryCreateInitialMovementSound(ctx);
                 }
                 break;
             case TransportMode::water:
-                continueUpdating = updateWater();
+                continueUpdating = updateWater(ctx);
                 if (continueUpdating)
                 {
-                    tryCreateInitialMovementSound();
+                    tryCreateInitialMovementSound(ctx);
                 }
                 break;
         }
         // TODO move to here when all update mode functions implemented
         //if (continueUpdating)
         //{
-        //    tryCreateInitialMovementSound();
+        //    tryCreateInitialMovementSound(ctx);
         //}
         return continueUpdating;
     }
@@ -549,12 +625,12 @@ namespace OpenLoco::Vehicles
     void VehicleHead::updateDrivingSounds()
     {
         Vehicle train(this);
-        updateDrivingSound(train.veh2->asVehicle2Or6());
-        updateDrivingSound(train.tail->asVehicle2Or6());
+        updateDrivingSound(train, train.veh2->asVehicle2Or6());
+        updateDrivingSound(train, train.tail->asVehicle2Or6());
     }
 
     // 0x004A88A6
-    void VehicleHead::updateDrivingSound(Vehicle2or6* vehType2or6)
+    void VehicleHead::updateDrivingSound(const Vehicle& train, Vehicle2or6* vehType2or6)
     {
         if (tile_x == -1 || status == Status::crashed || status == Status::stuck || (var_38 & Flags38::isGhost) || vehType2or6->objectId == 0xFFFF)
         {
@@ -569,13 +645,13 @@ namespace OpenLoco::Vehicles
                 updateDrivingSoundNone(vehType2or6);
                 break;
             case DrivingSoundType::friction:
-                updateDrivingSoundFriction(vehType2or6, &vehicleObject->sound.friction);
+                updateDrivingSoundFriction(train, vehType2or6, &vehicleObject->sound.friction);
                 break;
             case DrivingSoundType::engine1:
-                updateDrivingSoundEngine1(vehType2or6, &vehicleObject->sound.engine1);
+                updateDrivingSoundEngine1(train, vehType2or6, &vehicleObject->sound.engine1);
                 break;
             case DrivingSoundType::engine2:
-                updateDrivingSoundEngine2(vehType2or6, &vehicleObject->sound.engine2);
+                updateDrivingSoundEngine2(train, vehType2or6, &vehicleObject->sound.engine2);
                 break;
             default:
                 break;
@@ -589,9 +665,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A88F7
-    void VehicleHead::updateDrivingSoundFriction(Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd)
+    void VehicleHead::updateDrivingSoundFriction(const Vehicle& train, Vehicle2or6* vehType2or6, VehicleObjectFrictionSound* snd)
     {
-        Vehicle2* vehType2_2 = vehicleUpdate_2;
+        Vehicle2* vehType2_2 = train.veh2;
         if (vehType2_2->currentSpeed < snd->minSpeed)
         {
             updateDrivingSoundNone(vehType2or6);
@@ -608,9 +684,8 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8937
-    void VehicleHead::updateDrivingSoundEngine1(Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd)
+    void VehicleHead::updateDrivingSoundEngine1(const Vehicle& train, Vehicle2or6* vehType2or6, VehicleObjectEngine1Sound* snd)
     {
-        Vehicle train(this);
         if (vehType2or6->isVehicle2())
         {
             if (vehicleType != VehicleType::ship && vehicleType != VehicleType::aircraft)
@@ -628,7 +703,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        Vehicle2* vehType2_2 = vehicleUpdate_2;
+        Vehicle2* vehType2_2 = train.veh2;
         uint16_t targetFrequency = 0;
         uint8_t targetVolume = 0;
         if (vehType2_2->var_5A == 2)
@@ -701,9 +776,8 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8A39
-    void VehicleHead::updateDrivingSoundEngine2(Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd)
+    void VehicleHead::updateDrivingSoundEngine2(const Vehicle& train, Vehicle2or6* vehType2or6, VehicleObjectEngine2Sound* snd)
     {
-        Vehicle train(this);
         if (vehType2or6->isVehicle2())
         {
             if (vehicleType != VehicleType::ship && vehicleType != VehicleType::aircraft)
@@ -721,7 +795,7 @@ namespace OpenLoco::Vehicles
             }
         }
 
-        Vehicle2* vehType2_2 = vehicleUpdate_2;
+        Vehicle2* vehType2_2 = train.veh2;
         uint16_t targetFrequency = 0;
         uint8_t targetVolume = 0;
         bool var5aEqual1Code = false;
@@ -839,9 +913,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8C11
-    bool VehicleHead::updateLand()
+    bool VehicleHead::updateLand(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         if ((!(vehType2->var_73 & Flags73::isBrokenDown) || (vehType2->var_73 & Flags73::isStillPowered)) && status == Status::approaching)
         {
             if (mode == TransportMode::road)
@@ -849,39 +923,39 @@ namespace OpenLoco::Vehicles
                 uint8_t bl = sub_4AA36A();
                 if (bl == 1)
                 {
-                    return sub_4A8DB7();
+                    return sub_4A8DB7(ctx);
                 }
                 else if (bl == 2)
                 {
-                    return sub_4A8F22();
+                    return sub_4A8F22(ctx);
                 }
             }
 
             if (var_0C & Flags0C::commandStop)
             {
-                return sub_4A8CB6();
+                return sub_4A8CB6(ctx);
             }
             else if (var_0C & Flags0C::manualControl)
             {
                 if (var_6E <= -20)
                 {
-                    return sub_4A8C81();
+                    return sub_4A8C81(ctx);
                 }
             }
 
-            return landTryBeginUnloading();
+            return landTryBeginUnloading(ctx);
         }
 
         if (status == Status::unloading)
         {
-            updateUnloadCargo();
+            updateUnloadCargo(ctx);
 
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
         else if (status == Status::loading)
         {
-            return landLoadingUpdate();
+            return landLoadingUpdate(ctx);
         }
         else if (status == Status::crashed)
         {
@@ -903,21 +977,21 @@ namespace OpenLoco::Vehicles
                 {
                     if (!(var_0C & Flags0C::commandStop))
                     {
-                        return landNormalMovementUpdate();
+                        return landNormalMovementUpdate(ctx);
                     }
                     else
                     {
-                        return sub_4A8CB6();
+                        return sub_4A8CB6(ctx);
                     }
                 }
                 else
                 {
-                    return sub_4A8C81();
+                    return sub_4A8C81(ctx);
                 }
             }
             else
             {
-                return sub_4A8CB6();
+                return sub_4A8CB6(ctx);
             }
         }
     }
@@ -973,19 +1047,19 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8DB7
-    bool VehicleHead::sub_4A8DB7()
+    bool VehicleHead::sub_4A8DB7(UpdateContext& ctx)
     {
         sub_4AD778();
         if (status == Status::approaching)
         {
             status = Status::travelling;
         }
-        tryCreateInitialMovementSound();
+        tryCreateInitialMovementSound(ctx);
         return true;
     }
 
     // 0x004A8F22
-    bool VehicleHead::sub_4A8F22()
+    bool VehicleHead::sub_4A8F22(UpdateContext& ctx)
     {
         if (isOnExpectedRoadOrTrack())
         {
@@ -993,7 +1067,7 @@ namespace OpenLoco::Vehicles
             var_52 = 1;
             sub_4ADB47(false);
             var_52 = temp;
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
         else
@@ -1005,9 +1079,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A8CB6
-    bool VehicleHead::sub_4A8CB6()
+    bool VehicleHead::sub_4A8CB6(UpdateContext& ctx)
     {
-        Vehicle1* vehType1 = vehicleUpdate_1;
+        Vehicle1* vehType1 = ctx.veh1;
 
         if (position != vehType1->position)
         {
@@ -1023,38 +1097,38 @@ namespace OpenLoco::Vehicles
         auto* vehType2 = train.veh2;
         if (vehType2->var_36 != var_36 || vehType2->var_2E != var_2E)
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
 
         status = Status::stopped;
-        vehType2 = vehicleUpdate_2;
+        vehType2 = ctx.veh2;
 
         if (vehType2->var_73 & Flags73::isBrokenDown)
         {
             stationId = StationId::null;
             status = Status::brokenDown;
 
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
-        tryCreateInitialMovementSound();
+        tryCreateInitialMovementSound(ctx);
         return true;
     }
 
     // 0x004A8C81
-    bool VehicleHead::sub_4A8C81()
+    bool VehicleHead::sub_4A8C81(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         if (vehType2->currentSpeed > 1.0_mph)
         {
-            return landNormalMovementUpdate();
+            return landNormalMovementUpdate(ctx);
         }
 
         auto foundStationId = manualFindTrainStationAtLocation();
         if (foundStationId == StationId::null)
         {
-            return sub_4A8CB6();
+            return sub_4A8CB6(ctx);
         }
         stationId = foundStationId;
         setStationVisitedTypes();
@@ -1062,24 +1136,24 @@ namespace OpenLoco::Vehicles
         updateLastJourneyAverageSpeed();
         beginUnloading();
 
-        return sub_4A8CB6();
+        return sub_4A8CB6(ctx);
     }
 
     // 0x004A8FAC
     // Checks if at the desiered station and then begins unloading if at it
-    bool VehicleHead::landTryBeginUnloading()
+    bool VehicleHead::landTryBeginUnloading(UpdateContext& ctx)
     {
         Vehicle train(this);
         if (var_36 != train.veh2->var_36 || train.veh2->var_2E != var_2E)
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
 
         // Manual control is going too fast at this point to stop at the station
         if (var_0C & Flags0C::manualControl)
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
 
@@ -1088,16 +1162,16 @@ namespace OpenLoco::Vehicles
         updateLastJourneyAverageSpeed();
         beginUnloading();
 
-        tryCreateInitialMovementSound();
+        tryCreateInitialMovementSound(ctx);
         return true;
     }
 
     // 0x004A9011
-    bool VehicleHead::landLoadingUpdate()
+    bool VehicleHead::landLoadingUpdate(UpdateContext& ctx)
     {
         if (updateLoadCargo())
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
 
@@ -1107,52 +1181,52 @@ namespace OpenLoco::Vehicles
 
         if (var_0C & Flags0C::manualControl)
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
 
         if (sub_4ACCDC())
         {
-            return sub_4A8F22();
+            return sub_4A8F22(ctx);
         }
 
-        tryCreateInitialMovementSound();
+        tryCreateInitialMovementSound(ctx);
         return true;
     }
 
     // 0x004A8D48
-    bool VehicleHead::landNormalMovementUpdate()
+    bool VehicleHead::landNormalMovementUpdate(UpdateContext& ctx)
     {
         advanceToNextRoutableOrder();
-        auto [al, flags, nextStation] = sub_4ACEE7(0xD4CB00, vehicleUpdate_var_113612C);
+        auto [al, flags, nextStation] = sub_4ACEE7(0xD4CB00, ctx.var_113612C);
 
         if (mode == TransportMode::road)
         {
-            return roadNormalMovementUpdate(al, nextStation);
+            return roadNormalMovementUpdate(ctx, al, nextStation);
         }
         else
         {
-            return trainNormalMovementUpdate(al, flags, nextStation);
+            return trainNormalMovementUpdate(ctx, al, flags, nextStation);
         }
     }
 
     // 0x004A8D8F
-    bool VehicleHead::roadNormalMovementUpdate(uint8_t al, StationId_t nextStation)
+    bool VehicleHead::roadNormalMovementUpdate(UpdateContext& ctx, uint8_t al, StationId_t nextStation)
     {
         uint8_t bl = sub_4AA36A();
         if (bl == 1)
         {
-            return sub_4A8DB7();
+            return sub_4A8DB7(ctx);
         }
         else if (bl == 2)
         {
-            return sub_4A8F22();
+            return sub_4A8F22(ctx);
         }
         else if (al == 4)
         {
             status = Status::approaching;
             stationId = nextStation;
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
         else if (al == 2)
@@ -1160,34 +1234,34 @@ namespace OpenLoco::Vehicles
             Vehicle train(this);
             if (var_36 != train.veh2->var_36 || train.veh2->var_2E != var_2E)
             {
-                tryCreateInitialMovementSound();
+                tryCreateInitialMovementSound(ctx);
                 return true;
             }
-            return sub_4A8F22();
+            return sub_4A8F22(ctx);
         }
         else
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
     }
 
     // 0x004A8D63
-    bool VehicleHead::trainNormalMovementUpdate(uint8_t al, uint8_t flags, StationId_t nextStation)
+    bool VehicleHead::trainNormalMovementUpdate(UpdateContext& ctx, uint8_t al, uint8_t flags, StationId_t nextStation)
     {
         Vehicle train(this);
         if (al == 4)
         {
             status = Status::approaching;
             stationId = nextStation;
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
         else if (al == 3)
         {
             if (train.veh2->var_36 != var_36 || train.veh2->var_2E != var_2E)
             {
-                tryCreateInitialMovementSound();
+                tryCreateInitialMovementSound(ctx);
                 return true;
             }
 
@@ -1200,7 +1274,7 @@ namespace OpenLoco::Vehicles
             {
                 var_5C = 2;
                 vehType1->var_48 |= 1 << 0;
-                tryCreateInitialMovementSound();
+                tryCreateInitialMovementSound(ctx);
                 return true;
             }
 
@@ -1211,21 +1285,21 @@ namespace OpenLoco::Vehicles
                 {
                     if (flags & (1 << 7))
                     {
-                        return landReverseFromSignal();
+                        return landReverseFromSignal(ctx);
                     }
 
                     if (sub_4AC1C2())
                     {
                         var_5C = 2;
                         vehType1->var_48 |= 1 << 0;
-                        tryCreateInitialMovementSound();
+                        tryCreateInitialMovementSound(ctx);
                         return true;
                     }
-                    return landReverseFromSignal();
+                    return landReverseFromSignal(ctx);
                 }
 
                 // Keep waiting at the signal
-                tryCreateInitialMovementSound();
+                tryCreateInitialMovementSound(ctx);
                 return true;
             }
             else
@@ -1238,24 +1312,24 @@ namespace OpenLoco::Vehicles
                         {
                             var_5C = 2;
                             vehType1->var_48 |= 1 << 0;
-                            tryCreateInitialMovementSound();
+                            tryCreateInitialMovementSound(ctx);
                             return true;
                         }
                     }
 
                     if (sub_4AC0A3())
                     {
-                        return landReverseFromSignal();
+                        return landReverseFromSignal(ctx);
                     }
                 }
 
                 if (vehType1->timeAtSignal >= trainTwoWaySignalTimeout)
                 {
-                    return landReverseFromSignal();
+                    return landReverseFromSignal(ctx);
                 }
 
                 // Keep waiting at the signal
-                tryCreateInitialMovementSound();
+                tryCreateInitialMovementSound(ctx);
                 return true;
             }
         }
@@ -1269,7 +1343,7 @@ namespace OpenLoco::Vehicles
                     auto* vehType2 = train.veh2;
                     if (vehType2->var_36 != var_36 || vehType2->var_2E != var_2E)
                     {
-                        return landReverseFromSignal();
+                        return landReverseFromSignal(ctx);
                     }
 
                     // Crash
@@ -1277,46 +1351,47 @@ namespace OpenLoco::Vehicles
                     return false;
                 }
 
-                return landReverseFromSignal();
+                return landReverseFromSignal(ctx);
             }
             else
             {
-                tryCreateInitialMovementSound();
+                tryCreateInitialMovementSound(ctx);
                 return true;
             }
         }
     }
 
     // 0x004A8ED9
-    bool VehicleHead::landReverseFromSignal()
+    bool VehicleHead::landReverseFromSignal(UpdateContext& ctx)
     {
         Vehicle train(this);
         train.veh1->timeAtSignal = 0;
 
         if (var_36 != train.veh2->var_36 || train.veh2->var_2E != var_2E)
         {
-            tryCreateInitialMovementSound();
+            tryCreateInitialMovementSound(ctx);
             return true;
         }
-        return sub_4A8F22();
+        return sub_4A8F22(ctx);
     }
 
     // 0x004A9051
-    bool VehicleHead::updateAir()
+    bool VehicleHead::updateAir(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
 
         if (vehType2->currentSpeed >= 20.0_mph)
         {
-            vehicleUpdate_var_1136130 = 0x4000;
+            ctx.var_1136130 = 0x4000;
         }
         else
         {
-            vehicleUpdate_var_1136130 = 0x2000;
+            ctx.var_1136130 = 0x2000;
         }
+        ctx.publish();
 
         Vehicle train(this);
-        train.cars.firstCar.body->sub_4AAB0B();
+        train.cars.firstCar.body->sub_4AAB0B(ctx);
 
         if (status == Status::stopped)
         {
@@ -1330,18 +1405,18 @@ namespace OpenLoco::Vehicles
         }
         else if (status == Status::unloading)
         {
-            updateUnloadCargo();
+            updateUnloadCargo(ctx);
             return true;
         }
         else if (status == Status::loading)
         {
-            return airplaneLoadingUpdate();
+            return airplaneLoadingUpdate(ctx);
         }
         status = Status::travelling;
         auto [newStatus, targetSpeed] = airplaneGetNewStatus();
 
         status = newStatus;
-        Vehicle1* vehType1 = vehicleUpdate_1;
+        Vehicle1* vehType1 = ctx.veh1;
         vehType1->var_44 = targetSpeed;
 
         advanceToNextRoutableOrder();
@@ -1393,12 +1468,14 @@ namespace OpenLoco::Vehicles
 
         auto [manhattanDistance, targetZ, targetYaw] = sub_427122();
 
+        ctx.manhattanDistanceToStation = manhattanDistance;
         vehicleUpdate_manhattanDistanceToStation = manhattanDistance;
         vehicleUpdate_targetZ = targetZ;
 
         // Helicopter
         if (vehicleUpdate_var_525BB0 & AirportMovementNodeFlags::heliTakeoffEnd)
         {
+            ctx.helicopterTargetYaw = targetYaw;
             vehicleUpdate_helicopterTargetYaw = targetYaw;
             targetYaw = sprite_yaw;
             vehType2->var_5A = 1;
@@ -1473,7 +1550,7 @@ namespace OpenLoco::Vehicles
             vehType2->currentSpeed = 8.0_mph;
             if (targetZ != position.z)
             {
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
         }
         else
@@ -1490,7 +1567,7 @@ namespace OpenLoco::Vehicles
 
             if (manhattanDistance > targetTolerance)
             {
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
         }
 
@@ -1500,7 +1577,7 @@ namespace OpenLoco::Vehicles
 
             if (flags & AirportMovementNodeFlags::touchdown)
             {
-                produceTouchdownAirportSound();
+                produceTouchdownAirportSound(ctx);
             }
             if (flags & AirportMovementNodeFlags::taxiing)
             {
@@ -1509,7 +1586,7 @@ namespace OpenLoco::Vehicles
 
             if (flags & AirportMovementNodeFlags::terminal)
             {
-                return sub_4A95CB();
+                return sub_4A95CB(ctx);
             }
         }
 
@@ -1523,12 +1600,12 @@ namespace OpenLoco::Vehicles
 
         if (newMovementEdge != static_cast<uint8_t>(-2))
         {
-            return sub_4A9348(newMovementEdge, targetZ);
+            return sub_4A9348(ctx, newMovementEdge, targetZ);
         }
 
         if (vehType2->currentSpeed > 30.0_mph)
         {
-            return airplaneApproachTarget(targetZ);
+            return airplaneApproachTarget(ctx, targetZ);
         }
         else
         {
@@ -1554,25 +1631,10 @@ namespace OpenLoco::Vehicles
             return std::make_pair(Status::travelling, targetSpeed);
         }
 
-        auto station = StationManager::get(stationId);
-
-        Pos3 loc = {
-            station->unk_tile_x,
-            station->unk_tile_y,
-            station->unk_tile_z
-        };
-
-        auto tile = Map::TileManager::get(loc);
-        for (auto& el : tile)
+        auto airport = getAirportElement(stationId);
+        if (airport)
         {
-            auto elStation = el.asStation();
-            if (elStation == nullptr)
-                continue;
-
-            if (elStation->baseZ() != loc.z / 4)
-                continue;
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
+            auto airportObject = ObjectManager::get<AirportObject>(airport->objectId);
 
             uint8_t al = airportObject->movementEdges[airportMovementEdge].var_03;
             uint8_t cl = airportObject->movementEdges[airportMovementEdge].var_00;
@@ -1626,12 +1688,12 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A95CB
-    bool VehicleHead::sub_4A95CB()
+    bool VehicleHead::sub_4A95CB(UpdateContext& ctx)
     {
         if (var_0C & Flags0C::commandStop)
         {
             status = Status::stopped;
-            Vehicle2* vehType2 = vehicleUpdate_2;
+            Vehicle2* vehType2 = ctx.veh2;
             vehType2->currentSpeed = 0.0_mph;
         }
         else
@@ -1644,9 +1706,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A95F5
-    bool VehicleHead::airplaneLoadingUpdate()
+    bool VehicleHead::airplaneLoadingUpdate(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         vehType2->currentSpeed = 0.0_mph;
         vehType2->var_5A = 0;
         if (updateLoadCargo())
@@ -1670,7 +1732,7 @@ namespace OpenLoco::Vehicles
         {
             // Strangely the original would enter this function with an
             // uninitialised targetZ. We will pass a valid z.
-            return sub_4A9348(newMovementEdge, position.z);
+            return sub_4A9348(ctx, newMovementEdge, position.z);
         }
 
         status = Status::loading;
@@ -1678,17 +1740,17 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A94A9
-    bool VehicleHead::airplaneApproachTarget(uint16_t targetZ)
+    bool VehicleHead::airplaneApproachTarget(UpdateContext& ctx, uint16_t targetZ)
     {
         auto _yaw = sprite_yaw;
         // Helicopter
         if (vehicleUpdate_var_525BB0 & AirportMovementNodeFlags::heliTakeoffEnd)
         {
-            _yaw = vehicleUpdate_helicopterTargetYaw;
+            _yaw = ctx.helicopterTargetYaw;
         }
 
-        Vehicle1* vehType1 = vehicleUpdate_1;
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle1* vehType1 = ctx.veh1;
+        Vehicle2* vehType2 = ctx.veh2;
 
         auto [veh1Loc, veh2Loc] = calculateNextPosition(
             _yaw, position, vehType1, vehType2->currentSpeed);
@@ -1699,7 +1761,7 @@ namespace OpenLoco::Vehicles
         if (targetZ != position.z)
         {
             // Final section of landing / helicopter
-            if (vehicleUpdate_manhattanDistanceToStation <= 28)
+            if (ctx.manhattanDistanceToStation <= 28)
             {
                 int16_t z_shift = 1;
                 if (vehType2->currentSpeed >= 50.0_mph)
@@ -1725,7 +1787,7 @@ namespace OpenLoco::Vehicles
                 int32_t zDiff = targetZ - position.z;
                 // We want a SAR instruction so use >>5
                 int32_t param1 = (zDiff * toSpeed16(vehType2->currentSpeed).getRaw()) >> 5;
-                int32_t param2 = vehicleUpdate_manhattanDistanceToStation - 18;
+                int32_t param2 = ctx.manhattanDistanceToStation - 18;
 
                 auto modulo = param1 % param2;
                 if (modulo < 0)
@@ -1742,7 +1804,7 @@ namespace OpenLoco::Vehicles
         return true;
     }
 
-    bool VehicleHead::sub_4A9348(uint8_t newMovementEdge, uint16_t targetZ)
+    bool VehicleHead::sub_4A9348(UpdateContext& ctx, uint8_t newMovementEdge, uint16_t targetZ)
     {
         if (stationId != StationId::null && airportMovementEdge != cAirportMovementNodeNull)
         {
@@ -1757,7 +1819,7 @@ namespace OpenLoco::Vehicles
             {
                 // 0x4a94a5
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             auto orders = getCurrentOrders();
@@ -1765,7 +1827,7 @@ namespace OpenLoco::Vehicles
             if (order == nullptr)
             {
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             StationId_t orderStationId = order->getStation();
@@ -1775,14 +1837,14 @@ namespace OpenLoco::Vehicles
             if (station == nullptr || !(station->flags & StationFlags::flag_6))
             {
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             if (!isPlayerCompany(owner))
             {
                 stationId = orderStationId;
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             Pos3 loc = {
@@ -1809,7 +1871,7 @@ namespace OpenLoco::Vehicles
                 {
                     stationId = orderStationId;
                     airportMovementEdge = cAirportMovementNodeNull;
-                    return airplaneApproachTarget(targetZ);
+                    return airplaneApproachTarget(ctx, targetZ);
                 }
 
                 if (owner == CompanyManager::getControllingId())
@@ -1822,7 +1884,7 @@ namespace OpenLoco::Vehicles
                 }
 
                 airportMovementEdge = cAirportMovementNodeNull;
-                return airplaneApproachTarget(targetZ);
+                return airplaneApproachTarget(ctx, targetZ);
             }
 
             // Todo: fail gracefully on tile not found
@@ -1839,7 +1901,7 @@ namespace OpenLoco::Vehicles
                 auto station = StationManager::get(stationId);
                 station->airportMovementOccupiedEdges |= (1 << airportMovementEdge);
             }
-            return airplaneApproachTarget(targetZ);
+            return airplaneApproachTarget(ctx, targetZ);
         }
     }
 
@@ -1852,20 +1914,21 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A9649
-    bool VehicleHead::updateWater()
+    bool VehicleHead::updateWater(UpdateContext& ctx)
     {
-        Vehicle2* vehType2 = vehicleUpdate_2;
+        Vehicle2* vehType2 = ctx.veh2;
         if (vehType2->currentSpeed >= 5.0_mph)
         {
-            vehicleUpdate_var_1136130 = 0x4000;
+            ctx.var_1136130 = 0x4000;
         }
         else
         {
-            vehicleUpdate_var_1136130 = 0x2000;
+            ctx.var_1136130 = 0x2000;
         }
+        ctx.publish();
 
         Vehicle train(this);
-        train.cars.firstCar.body->sub_4AAB0B();
+        train.cars.firstCar.body->sub_4AAB0B(ctx);
 
         if (status == Status::stopped)
         {
@@ -1887,7 +1950,7 @@ namespace OpenLoco::Vehicles
 
         if (var_0C & Flags0C::commandStop)
         {
-            if (!(updateWaterMotion(WaterMotionFlags::isStopping) & WaterMotionFlags::hasReachedADestination))
+            if (!(updateWaterMotion(ctx, WaterMotionFlags::isStopping) & WaterMotionFlags::hasReachedADestination))
             {
                 return true;
             }
@@ -1900,7 +1963,7 @@ namespace OpenLoco::Vehicles
 
         if (status == Status::unloading)
         {
-            updateUnloadCargo();
+            updateUnloadCargo(ctx);
             return true;
         }
         else if (status == Status::loading)
@@ -1914,8 +1977,8 @@ namespace OpenLoco::Vehicles
             advanceToNextRoutableOrder();
             status = Status::travelling;
             status = sub_427BF2();
-            updateWaterMotion(WaterMotionFlags::isLeavingDock);
-            produceLeavingDockSound();
+            updateWaterMotion(ctx, WaterMotionFlags::isLeavingDock);
+            produceLeavingDockSound(ctx);
             return true;
         }
         else
@@ -1923,7 +1986,7 @@ namespace OpenLoco::Vehicles
             status = Status::travelling;
             status = sub_427BF2();
             advanceToNextRoutableOrder();
-            if (!(updateWaterMotion(0) & WaterMotionFlags::hasReachedDock))
+            if (!(updateWaterMotion(ctx, 0) & WaterMotionFlags::hasReachedDock))
             {
                 return true;
             }
@@ -2025,54 +2088,20 @@ namespace OpenLoco::Vehicles
     // 0x00427214 returns next movement edge or -2 if no valid edge or -1 for in flight
     uint8_t VehicleHead::airportGetNextMovementEdge(uint8_t curEdge)
     {
-        auto station = StationManager::get(stationId);
-
-        Pos3 loc = {
-            station->unk_tile_x,
-            station->unk_tile_y,
-            station->unk_tile_z
-        };
-
-        auto tile = TileManager::get(loc);
-
-        for (auto& el : tile)
+        auto airport = getAirportElement(stationId);
+        if (airport)
         {
-            auto elStation = el.asStation();
-            if (elStation == nullptr)
-                continue;
-
-            if (elStation->baseZ() != loc.z / 4)
-                continue;
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
+            auto station = StationManager::get(stationId);
+            auto airportObject = ObjectManager::get<AirportObject>(airport->objectId);
 
             if (curEdge == cAirportMovementNodeNull)
             {
-                for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
+                for (const auto& transition : AirportObject::getEntryEdges(airport->objectId))
                 {
-                    const auto& transition = airportObject->movementEdges[movementEdge];
-                    if (!(airportObject->movementNodes[transition.curNode].flags & AirportMovementNodeFlags::flag2))
-                    {
-                        continue;
-                    }
-
-                    if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                    {
-                        continue;
-                    }
-
-                    if (transition.atLeastOneClearEdges == 0)
+                    if (transition.canUse(station->airportMovementOccupiedEdges))
                     {
-                        return movementEdge;
+                        return transition.edge;
                     }
-
-                    auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                    if (occupiedAreas == transition.atLeastOneClearEdges)
-                    {
-                        continue;
-                    }
-
-                    return movementEdge;
                 }
                 return -2;
             }
@@ -2086,77 +2115,15 @@ namespace OpenLoco::Vehicles
                 // 0x4272A5
                 Vehicle train(this);
                 auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->object_id);
-                if (vehObject->flags & FlagsE0::isHelicopter)
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = airportObject->movementEdges[movementEdge];
-
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (airportObject->movementNodes[transition.nextNode].flags & AirportMovementNodeFlags::takeoffBegin)
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
-
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
-                        return movementEdge;
-                    }
-
-                    return -2;
-                }
-                else
+                const bool isHelicopter = vehObject->flags & FlagsE0::isHelicopter;
+                for (const auto& transition : AirportObject::getOutgoingEdges(airport->objectId, targetNode, isHelicopter))
                 {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
+                    if (transition.canUse(station->airportMovementOccupiedEdges))
                     {
-                        const auto& transition = airportObject->movementEdges[movementEdge];
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (airportObject->movementNodes[transition.nextNode].flags & AirportMovementNodeFlags::heliTakeoffBegin)
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
-
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
-
-                        return movementEdge;
+                        return transition.edge;
                     }
-                    return -2;
                 }
+                return -2;
             }
         }
 
@@ -2168,26 +2135,11 @@ namespace OpenLoco::Vehicles
     // 0x00426E26
     std::pair<uint32_t, Map::Pos3> VehicleHead::airportGetMovementEdgeTarget(StationId_t targetStation, uint8_t curEdge)
     {
-        auto station = StationManager::get(targetStation);
-
-        Pos3 staionLoc = {
-            station->unk_tile_x,
-            station->unk_tile_y,
-            station->unk_tile_z
-        };
-
-        auto tile = TileManager::get(staionLoc);
-
-        for (auto& el : tile)
+        auto airport = getAirportElement(targetStation);
+        if (airport)
         {
-            auto elStation = el.asStation();
-            if (elStation == nullptr)
-                continue;
-
-            if (elStation->baseZ() != staionLoc.z / 4)
-                continue;
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
+            const auto& staionLoc = airport->loc;
+            auto airportObject = ObjectManager::get<AirportObject>(airport->objectId);
 
             auto destinationNode = airportObject->movementEdges[curEdge].nextNode;
 
@@ -2195,7 +2147,7 @@ namespace OpenLoco::Vehicles
                 static_cast<int16_t>(airportObject->movementNodes[destinationNode].x - 16),
                 static_cast<int16_t>(airportObject->movementNodes[destinationNode].y - 16)
             };
-            loc2 = Math::Vector::rotate(loc2, elStation->rotation());
+            loc2 = Math::Vector::rotate(loc2, airport->rotation);
             auto airportFlags = airportObject->movementNodes[destinationNode].flags;
 
             loc2.x += 16 + staionLoc.x;
@@ -2222,14 +2174,14 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004B980A
-    void VehicleHead::tryCreateInitialMovementSound()
+    void VehicleHead::tryCreateInitialMovementSound(const UpdateContext& ctx)
     {
         if (status != Status::travelling)
         {
             return;
         }
 
-        if (vehicleUpdate_initialStatus != Status::stopped && vehicleUpdate_initialStatus != Status::waitingAtSignal)
+        if (ctx.initialStatus != Status::stopped && ctx.initialStatus != Status::waitingAtSignal)
         {
             return;
         }
@@ -2246,7 +2198,7 @@ namespace OpenLoco::Vehicles
             }
             auto randSoundIndex = gPrng().randNext(numSounds - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             auto tileHeight = TileManager::getHeight(veh2->position);
             auto volume = 0;
             if (veh2->position.z < tileHeight.landHeight)
@@ -2352,9 +2304,9 @@ namespace OpenLoco::Vehicles
     // Output flags:
     // bit 16 : reachedDock
     // bit 17 : reachedADestination
-    uint32_t VehicleHead::updateWaterMotion(uint32_t flags)
+    uint32_t VehicleHead::updateWaterMotion(UpdateContext& ctx, uint32_t flags)
     {
-        Vehicle2* veh2 = vehicleUpdate_2;
+        Vehicle2* veh2 = ctx.veh2;
 
         // updates the current boats position and sets flags about position
         auto tile = TileManager::get(veh2->position);
@@ -2520,7 +2472,7 @@ namespace OpenLoco::Vehicles
             veh2->sprite_yaw &= 0x3F;
         }
 
-        Vehicle1* veh1 = vehicleUpdate_1;
+        Vehicle1* veh1 = ctx.veh1;
         auto [newVeh1Pos, newVeh2Pos] = calculateNextPosition(veh2->sprite_yaw, veh2->position, veh1, veh2->currentSpeed);
 
         veh1->var_4E = newVeh1Pos.x;
@@ -2736,7 +2688,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004B9A2A
-    void VehicleHead::updateUnloadCargo()
+    void VehicleHead::updateUnloadCargo(const UpdateContext& ctx)
     {
         if (cargoTransferTimeout != 0)
         {
@@ -2789,9 +2741,9 @@ namespace OpenLoco::Vehicles
                 auto company = CompanyManager::get(owner);
                 company->var_4A8[var_60].var_80 += cargoProfit;
             }
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             veh2->lifetimeProfit += cargoProfit;
-            Vehicle1* veh1 = vehicleUpdate_1;
+            Vehicle1* veh1 = ctx.veh1;
             if (cargoProfit != 0)
             {
                 veh1->var_48 |= (1 << 2);
@@ -2845,12 +2797,14 @@ namespace OpenLoco::Vehicles
         {
             return;
         }
-        OrderRingView orders(orderTableOffset, currentOrder);
-        for (auto& order : orders)
+        const auto orders = getDecodedOrders(*this);
+        const auto currentIndex = findDecodedOrder(orders, currentOrder);
+        for (size_t i = 0; currentIndex < orders.size() && i < orders.size(); ++i)
         {
-            if (order.hasFlag(OrderFlags::IsRoutable))
+            const auto& order = orders[(currentIndex + i) % orders.size()];
+            if (order.order->hasFlag(OrderFlags::IsRoutable))
             {
-                auto newOrder = order.getOffset() - orderTableOffset;
+                auto newOrder = order.offset;
                 if (newOrder != currentOrder)
                 {
                     currentOrder = newOrder;
@@ -2868,7 +2822,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x0042843E
-    void VehicleHead::produceLeavingDockSound()
+    void VehicleHead::produceLeavingDockSound(const UpdateContext& ctx)
     {
         Vehicle train(this);
         auto* vehObj = train.cars.firstCar.body->object();
@@ -2876,7 +2830,7 @@ namespace OpenLoco::Vehicles
         {
             auto randSoundIndex = gPrng().randNext((vehObj->numStartSounds & NumStartSounds::mask) - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             Audio::playSound(randSoundId, veh2->position + Map::Pos3{ 0, 0, 22 }, 0, 22050);
         }
     }
@@ -2893,7 +2847,7 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x0042750E
-    void VehicleHead::produceTouchdownAirportSound()
+    void VehicleHead::produceTouchdownAirportSound(const UpdateContext& ctx)
     {
         Vehicle train(this);
         auto* vehObj = train.cars.firstCar.body->object();
@@ -2903,7 +2857,7 @@ namespace OpenLoco::Vehicles
             auto randSoundIndex = gPrng().randNext((vehObj->numStartSounds & NumStartSounds::mask) - 1);
             auto randSoundId = Audio::makeObjectSoundId(vehObj->startSounds[randSoundIndex]);
 
-            Vehicle2* veh2 = vehicleUpdate_2;
+            Vehicle2* veh2 = ctx.veh2;
             Audio::playSound(randSoundId, veh2->position + Map::Pos3{ 0, 0, 22 }, 0, 22050);
         }
     }
@@ -1,11 +1,174 @@
 #include "VehicleManager.h"
 #include "../Company.h"
+#include "../Entities/EntityManager.h"
 #include "../Interop/Interop.hpp"
+#include "Vehicle.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
 namespace OpenLoco::VehicleManager
 {
+    // Below this many trains per thread the cost of waking a worker outweighs the work
+    static constexpr size_t minTrainsPerWorker = 256;
+
+    // Threads kept for the lifetime of the game so the pre-pass does not start new ones every tick
+    class WorkerPool
+    {
+    private:
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        std::function<void(size_t)> _job;
+        size_t _numJobs = 0;
+        std::atomic<size_t> _nextJob{ 0 };
+        size_t _numBusy = 0;
+        uint32_t _batch = 0;
+        bool _stopping = false;
+        std::exception_ptr _firstError;
+
+        void runJobs()
+        {
+            for (auto job = _nextJob++; job < _numJobs; job = _nextJob++)
+            {
+                try
+                {
+                    _job(job);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (_firstError == nullptr)
+                    {
+                        _firstError = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        void workerMain()
+        {
+            uint32_t lastBatch = 0;
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true)
+            {
+                _wake.wait(lock, [&] { return _stopping || _batch != lastBatch; });
+                if (_stopping)
+                {
+                    return;
+                }
+                lastBatch = _batch;
+
+                lock.unlock();
+                runJobs();
+                lock.lock();
+
+                if (--_numBusy == 0)
+                {
+                    _done.notify_one();
+                }
+            }
+        }
+
+    public:
+        WorkerPool()
+        {
+            // The calling thread works on each batch too
+            const auto numThreads = std::max(1U, std::thread::hardware_concurrency()) - 1;
+            for (uint32_t i = 0; i < numThreads; i++)
+            {
+                _threads.emplace_back([this] { workerMain(); });
+            }
+        }
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _wake.notify_all();
+            for (auto& thread : _threads)
+            {
+                thread.join();
+            }
+        }
+
+        size_t size() const
+        {
+            return _threads.size() + 1;
+        }
+
+        // Runs job(0) to job(numJobs - 1) on the workers and the calling thread, returning once all have
+        // finished. The first exception thrown by a job is rethrown here.
+        void run(size_t numJobs, std::function<void(size_t)> job)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job = std::move(job);
+                _numJobs = numJobs;
+                _nextJob = 0;
+                _firstError = nullptr;
+                _numBusy = _threads.size();
+                _batch++;
+            }
+            _wake.notify_all();
+            runJobs();
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock, [this] { return _numBusy == 0; });
+            if (_firstError != nullptr)
+            {
+                std::rethrow_exception(_firstError);
+            }
+        }
+    };
+
+    struct DrivingSound
+    {
+        SoundObjectId_t id;
+        uint8_t volume;
+        uint16_t frequency;
+
+        DrivingSound() = default;
+        DrivingSound(const Vehicles::Vehicle2or6& vehicle)
+            : id(vehicle.drivingSoundId)
+            , volume(vehicle.drivingSoundVolume)
+            , frequency(vehicle.drivingSoundFrequency)
+        {
+        }
+
+        void restore(Vehicles::Vehicle2or6& vehicle) const
+        {
+            vehicle.drivingSoundId = id;
+            vehicle.drivingSoundVolume = volume;
+            vehicle.drivingSoundFrequency = frequency;
+        }
+    };
+
+    // The state of a train the pre-pass based its driving sounds on, and the sounds from before the pre-pass
+    struct DrivingSoundSnapshot
+    {
+        uint32_t pass;
+        Vehicles::Status status;
+        int16_t tileX;
+        DrivingSound veh2;
+        DrivingSound tail;
+    };
+
+    static std::vector<Vehicles::VehicleHead*> _drivingSoundHeads;
+    static std::array<DrivingSoundSnapshot, EntityManager::maxEntities> _drivingSoundSnapshots;
+    static uint32_t _drivingSoundPass = 0;
+
     // 0x004C3A0C
     void determineAvailableVehicles(Company& company)
     {
@@ -13,4 +176,71 @@ namespace OpenLoco::VehicleManager
         regs.esi = reinterpret_cast<int32_t>(&company);
         call(0x004C3A0C, regs);
     }
+
+    static void updateDrivingSounds(Vehicles::VehicleHead* const* begin, Vehicles::VehicleHead* const* end)
+    {
+        for (auto it = begin; it != end; ++it)
+        {
+            auto& head = **it;
+            Vehicles::Vehicle train(&head);
+            auto& snapshot = _drivingSoundSnapshots[head.id];
+            snapshot.pass = _drivingSoundPass;
+            snapshot.status = head.status;
+            snapshot.tileX = head.tile_x;
+            snapshot.veh2 = DrivingSound(*train.veh2->asVehicle2Or6());
+            snapshot.tail = DrivingSound(*train.tail->asVehicle2Or6());
+            head.updateDrivingSounds();
+        }
+    }
+
+    // Driving sounds only read the state of their own train and only write to its vehicle 2 and tail,
+    // so they are computed for every train ahead of the serial vehicle update. On large networks the
+    // trains are split over worker threads.
+    void updateDrivingSounds()
+    {
+        _drivingSoundPass++;
+        _drivingSoundHeads.clear();
+        for (auto* head : EntityManager::VehicleList())
+        {
+            _drivingSoundHeads.push_back(head);
+        }
+
+        Vehicles::VehicleHead* const* begin = _drivingSoundHeads.data();
+        Vehicles::VehicleHead* const* end = begin + _drivingSoundHeads.size();
+        const size_t numJobs = _drivingSoundHeads.size() / minTrainsPerWorker;
+        if (numJobs <= 1 || std::thread::hardware_concurrency() <= 1)
+        {
+            updateDrivingSounds(begin, end);
+            return;
+        }
+
+        static WorkerPool workers;
+        const size_t share = (_drivingSoundHeads.size() + numJobs - 1) / numJobs;
+        workers.run(numJobs, [begin, end, share](size_t job) {
+            auto* jobBegin = begin + job * share;
+            updateDrivingSounds(jobBegin, std::min(jobBegin + share, end));
+        });
+    }
+
+    // The pre-pass runs before any train moves, whereas the original calculated each train's sounds
+    // just before updating it. When an earlier train changed this one (e.g. by crashing into it) the
+    // sounds from before the pre-pass are put back so the caller can calculate them again.
+    bool restoreStaleDrivingSounds(Vehicles::VehicleHead& head)
+    {
+        const auto& snapshot = _drivingSoundSnapshots[head.id];
+        if (snapshot.pass != _drivingSoundPass)
+        {
+            // Not part of the pre-pass, e.g. created by an earlier train this tick
+            return true;
+        }
+        if (snapshot.status == head.status && snapshot.tileX == head.tile_x)
+        {
+            return false;
+        }
+
+        Vehicles::Vehicle train(&head);
+        snapshot.veh2.restore(*train.veh2->asVehicle2Or6());
+        snapshot.tail.restore(*train.tail->asVehicle2Or6());
+        return true;
+    }
 }
@@ -5,7 +5,14 @@ namespace OpenLoco
     struct Company;
 }
 
+namespace OpenLoco::Vehicles
+{
+    struct VehicleHead;
+}
+
 namespace OpenLoco::VehicleManager
 {
     void determineAvailableVehicles(Company& company);
+    void updateDrivingSounds();
+    bool restoreStaleDrivingSounds(Vehicles::VehicleHead& head);
 }
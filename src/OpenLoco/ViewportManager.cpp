@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <optional>
 
 using namespace OpenLoco::Ui;
 using namespace OpenLoco::Interop;
@@ -23,6 +24,60 @@ namespace OpenLoco::Ui::ViewportManager
 
     static viewport* create(registers regs, int index);
 
+    // Sprite invalidations made between begin/endEntityInvalidationBatch, merged into one
+    // rectangle per zoom level so that a run of particles only walks the viewports once
+    struct EntityInvalidationBatch
+    {
+        std::optional<ViewportRect> rect;
+        int32_t spriteArea = 0;
+    };
+    static bool _isBatchingEntityInvalidations = false;
+    static std::array<EntityInvalidationBatch, ZoomLevel::max> _entityInvalidationBatches;
+
+    static void invalidate(const ViewportRect& rect, ZoomLevel zoom);
+
+    static int32_t getArea(const ViewportRect& rect)
+    {
+        return std::max(0, rect.right - rect.left) * std::max(0, rect.bottom - rect.top);
+    }
+
+    static void flushEntityInvalidationBatch(uint8_t level)
+    {
+        auto& batch = _entityInvalidationBatches[level];
+        if (batch.rect)
+        {
+            invalidate(*batch.rect, level);
+        }
+        batch.rect.reset();
+        batch.spriteArea = 0;
+    }
+
+    static void addToEntityInvalidationBatch(const ViewportRect& rect, uint8_t level)
+    {
+        auto& batch = _entityInvalidationBatches[level];
+        if (batch.rect)
+        {
+            ViewportRect merged;
+            merged.left = std::min(batch.rect->left, rect.left);
+            merged.top = std::min(batch.rect->top, rect.top);
+            merged.right = std::max(batch.rect->right, rect.right);
+            merged.bottom = std::max(batch.rect->bottom, rect.bottom);
+
+            // Particles of a batch are normally close together, but don't let a stray one far away
+            // turn the merged rectangle into a redraw of most of the screen
+            const auto spriteArea = batch.spriteArea + getArea(rect);
+            if (getArea(merged) <= spriteArea * 4)
+            {
+                batch.rect = merged;
+                batch.spriteArea = spriteArea;
+                return;
+            }
+            flushEntityInvalidationBatch(level);
+        }
+        batch.rect = rect;
+        batch.spriteArea = getArea(rect);
+    }
+
     void init()
     {
         _viewports.clear();
@@ -311,9 +366,28 @@ namespace OpenLoco::Ui::ViewportManager
         rect.bottom = t->sprite_bottom;
 
         auto level = (ZoomLevel)std::min(Config::get().vehicles_min_scale, (uint8_t)zoom);
+        if (_isBatchingEntityInvalidations)
+        {
+            addToEntityInvalidationBatch(rect, level);
+            return;
+        }
         invalidate(rect, level);
     }
 
+    void beginEntityInvalidationBatch()
+    {
+        _isBatchingEntityInvalidations = true;
+    }
+
+    void endEntityInvalidationBatch()
+    {
+        _isBatchingEntityInvalidations = false;
+        for (uint8_t level = 0; level < ZoomLevel::max; level++)
+        {
+            flushEntityInvalidationBatch(level);
+        }
+    }
+
     void invalidate(const Map::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom, int radius)
     {
         auto axbx = Map::coordinate3dTo2d(pos.x + 16, pos.y + 16, zMax, currentRotation);
@@ -332,6 +406,24 @@ namespace OpenLoco::Ui::ViewportManager
         invalidate(rect, zoom);
     }
 
+    // Fills rects with the area of the map, in view coordinates, shown by each viewport
+    void getVisibleRects(std::vector<ViewportRect>& rects)
+    {
+        rects.clear();
+        for (auto& vp : _viewports)
+        {
+            if (vp->width == 0)
+                continue;
+
+            ViewportRect rect;
+            rect.left = vp->view_x;
+            rect.top = vp->view_y;
+            rect.right = vp->view_x + vp->view_width;
+            rect.bottom = vp->view_y + vp->view_height;
+            rects.push_back(rect);
+        }
+    }
+
     void registerHooks()
     {
         registerHook(
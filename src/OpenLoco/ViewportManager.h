@@ -6,6 +6,7 @@
 #include "Types.hpp"
 #include "Window.h"
 #include <array>
+#include <vector>
 
 namespace OpenLoco::Ui::ViewportManager
 {
@@ -18,5 +19,8 @@ namespace OpenLoco::Ui::ViewportManager
     viewport* create(window* window, int viewportIndex, Gfx::point_t origin, Gfx::ui_size_t size, ZoomLevel zoom, Map::Pos3 tile);
     void invalidate(Station* station);
     void invalidate(EntityBase* t, ZoomLevel zoom);
+    void beginEntityInvalidationBatch();
+    void endEntityInvalidationBatch();
     void invalidate(Map::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom = ZoomLevel::eighth, int radius = 32);
+    void getVisibleRects(std::vector<ViewportRect>& rects);
 }
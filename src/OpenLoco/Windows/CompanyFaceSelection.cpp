@@ -56,9 +56,9 @@ namespace OpenLoco::Ui::Windows::CompanyFaceSelection
     static void findAllInUseCompetitors(const CompanyId_t id)
     {
         std::vector<uint8_t> takenCompetitorIds;
-        for (const auto& c : CompanyManager::companies())
+        for (const auto& c : CompanyManager::activeCompanies())
         {
-            if (!c.empty() && c.id() != id)
+            if (c.id() != id)
             {
                 takenCompetitorIds.push_back(c.competitor_id);
             }
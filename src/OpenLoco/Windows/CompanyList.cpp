@@ -254,14 +254,9 @@ namespace OpenLoco::Ui::Windows::CompanyList
         {
             auto chosenCompany = -1;
 
-            auto i = -1;
-
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                i++;
-                if (company.empty())
-                    continue;
-
+                const auto i = company.id();
                 if ((company.challenge_flags & CompanyFlags::sorted) != 0)
                     continue;
 
@@ -673,22 +668,16 @@ namespace OpenLoco::Ui::Windows::CompanyList
 
             uint16_t maxHistorySize = 1;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 if (maxHistorySize < company.history_size)
                     maxHistorySize = company.history_size;
             }
 
             uint8_t count = 0;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 auto companyId = company.id();
                 auto companyColour = CompanyManager::getCompanyColour(companyId);
 
@@ -770,22 +759,16 @@ namespace OpenLoco::Ui::Windows::CompanyList
 
             uint16_t maxHistorySize = 1;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 if (maxHistorySize < company.history_size)
                     maxHistorySize = company.history_size;
             }
 
             uint8_t count = 0;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 auto companyId = company.id();
                 auto companyColour = CompanyManager::getCompanyColour(companyId);
 
@@ -867,22 +850,16 @@ namespace OpenLoco::Ui::Windows::CompanyList
 
             uint16_t maxHistorySize = 1;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 if (maxHistorySize < company.history_size)
                     maxHistorySize = company.history_size;
             }
 
             uint8_t count = 0;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 auto companyId = company.id();
                 auto companyColour = CompanyManager::getCompanyColour(companyId);
 
@@ -964,22 +941,16 @@ namespace OpenLoco::Ui::Windows::CompanyList
 
             uint16_t maxHistorySize = 1;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 if (maxHistorySize < company.history_size)
                     maxHistorySize = company.history_size;
             }
 
             uint8_t count = 0;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 auto companyId = company.id();
                 auto companyColour = CompanyManager::getCompanyColour(companyId);
 
@@ -1386,10 +1357,8 @@ namespace OpenLoco::Ui::Windows::CompanyList
                 if (frontWindow != nullptr && frontWindow == self && xDiff <= 100 && xDiff >= 0 && yDiff < 150 && yDiff >= 0)
                 {
                     auto listY = yDiff;
-                    for (auto& company : CompanyManager::companies())
+                    for (auto& company : CompanyManager::activeCompanies())
                     {
-                        if (company.empty())
-                            continue;
                         listY -= 10;
                         if (listY <= 0)
                         {
@@ -1668,11 +1637,8 @@ namespace OpenLoco::Ui::Windows::CompanyList
         {
             self->row_count = 0;
 
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 company.challenge_flags &= ~CompanyFlags::sorted;
             }
         }
@@ -1690,11 +1656,8 @@ namespace OpenLoco::Ui::Windows::CompanyList
         static void drawGraphLegend(window* self, Gfx::drawpixelinfo_t* dpi, int16_t x, int16_t y)
         {
             auto companyCount = 0;
-            for (auto& company : CompanyManager::companies())
+            for (auto& company : CompanyManager::activeCompanies())
             {
-                if (company.empty())
-                    continue;
-
                 auto companyColour = CompanyManager::getCompanyColour(company.id());
                 auto colour = Colour::getShade(companyColour, 6);
                 auto stringId = StringIds::small_black_string;
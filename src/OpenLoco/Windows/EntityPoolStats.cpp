@@ -0,0 +1,179 @@
+#include "../Entities/EntityManager.h"
+#include "../Graphics/Colour.h"
+#include "../Graphics/Gfx.h"
+#include "../Graphics/ImageIds.h"
+#include "../Localisation/FormatArguments.hpp"
+#include "../Localisation/StringIds.h"
+#include "../Objects/InterfaceSkinObject.h"
+#include "../Objects/ObjectManager.h"
+#include "../Ui/WindowManager.h"
+#include <iterator>
+
+namespace OpenLoco::Ui::Windows::EntityPoolStats
+{
+    constexpr Gfx::ui_size_t windowSize = { 400, 110 };
+    constexpr int16_t rowHeight = 10;
+
+    // Left edge of each column of the table
+    constexpr int16_t columnX[] = { 6, 86, 156, 196, 236, 281, 326, 366 };
+
+    constexpr EntityManager::EntityListType listsShown[] = {
+        EntityManager::EntityListType::null,
+        EntityManager::EntityListType::nullMoney,
+        EntityManager::EntityListType::vehicleHead,
+        EntityManager::EntityListType::vehicle,
+        EntityManager::EntityListType::misc,
+    };
+
+    namespace widx
+    {
+        enum
+        {
+            frame,
+            title,
+            close,
+            panel,
+            saveLog,
+        };
+    }
+
+    static widget_t _widgets[] = {
+        makeWidget({ 0, 0 }, windowSize, widget_type::frame, 0),
+        makeWidget({ 1, 1 }, { windowSize.width - 2, 13 }, widget_type::caption_25, 0, StringIds::entity_pool_stats),
+        makeWidget({ windowSize.width - 15, 2 }, { 13, 13 }, widget_type::wt_9, 0, ImageIds::close_button, StringIds::tooltip_close_window),
+        makeWidget({ 0, 15 }, { windowSize.width, windowSize.height - 15 }, widget_type::panel, 1),
+        makeWidget({ windowSize.width - 84, windowSize.height - 17 }, { 80, 12 }, widget_type::wt_11, 1, StringIds::entity_pool_stats_save_log),
+        widgetEnd(),
+    };
+
+    static window_event_list _events;
+
+    static void initEvents();
+
+    window* open()
+    {
+        auto window = WindowManager::bringToFront(WindowType::entityPoolStats);
+        if (window != nullptr)
+            return window;
+
+        initEvents();
+
+        window = WindowManager::createWindow(
+            WindowType::entityPoolStats,
+            windowSize,
+            0,
+            &_events);
+
+        window->widgets = _widgets;
+        window->enabled_widgets = (1 << widx::close) | (1 << widx::saveLog);
+        window->initScrollWidgets();
+
+        auto skin = ObjectManager::get<InterfaceSkinObject>();
+        window->colours[0] = skin->colour_0B;
+        window->colours[1] = skin->colour_0C;
+
+        return window;
+    }
+
+    static string_id getListStringId(const EntityManager::EntityListType list)
+    {
+        switch (list)
+        {
+            case EntityManager::EntityListType::null:
+                return StringIds::entity_pool_stats_list_free;
+            case EntityManager::EntityListType::nullMoney:
+                return StringIds::entity_pool_stats_list_free_money;
+            case EntityManager::EntityListType::vehicleHead:
+                return StringIds::entity_pool_stats_list_vehicle_heads;
+            case EntityManager::EntityListType::vehicle:
+                return StringIds::entity_pool_stats_list_vehicles;
+            default:
+                return StringIds::entity_pool_stats_list_misc;
+        }
+    }
+
+    static void drawCell(Gfx::drawpixelinfo_t* const context, const int16_t x, const int16_t y, const string_id stringId, FormatArguments& args)
+    {
+        Gfx::drawString_494B3F(*context, x, y, Colour::black, stringId, &args);
+    }
+
+    static void drawValue(Gfx::drawpixelinfo_t* const context, const int16_t x, const int16_t y, const uint32_t value)
+    {
+        auto args = FormatArguments::common(static_cast<int32_t>(value));
+        drawCell(context, x, y, StringIds::entity_pool_stats_value, args);
+    }
+
+    static void draw(Ui::window* const self, Gfx::drawpixelinfo_t* const context)
+    {
+        // Draw widgets.
+        self->draw(context);
+
+        int16_t y = self->y + 20;
+        constexpr string_id header[] = {
+            StringIds::entity_pool_stats_list,
+            StringIds::entity_pool_stats_count,
+            StringIds::entity_pool_stats_low,
+            StringIds::entity_pool_stats_high,
+            StringIds::entity_pool_stats_allocations,
+            StringIds::entity_pool_stats_frees,
+            StringIds::entity_pool_stats_failures,
+            StringIds::entity_pool_stats_last_tick,
+        };
+        static_assert(std::size(header) == std::size(columnX));
+        for (size_t i = 0; i < std::size(header); i++)
+        {
+            auto args = FormatArguments::common(header[i]);
+            drawCell(context, self->x + columnX[i], y, StringIds::wcolour2_stringid, args);
+        }
+        y += rowHeight + 2;
+
+        for (const auto list : listsShown)
+        {
+            const auto& stats = EntityManager::getPoolStats(list);
+            const auto x = self->x;
+
+            auto name = FormatArguments::common(getListStringId(list));
+            drawCell(context, x + columnX[0], y, StringIds::wcolour2_stringid, name);
+
+            auto count = FormatArguments::common(static_cast<int32_t>(EntityManager::getListCount(list)), static_cast<int32_t>(EntityManager::getListCapacity(list)));
+            drawCell(context, x + columnX[1], y, StringIds::entity_pool_stats_count_value, count);
+
+            drawValue(context, x + columnX[2], y, stats.lowWater);
+            drawValue(context, x + columnX[3], y, stats.highWater);
+            drawValue(context, x + columnX[4], y, stats.allocations);
+            drawValue(context, x + columnX[5], y, stats.frees);
+            drawValue(context, x + columnX[6], y, stats.failures);
+
+            auto lastTick = FormatArguments::common(static_cast<int32_t>(stats.allocationsLastTick), static_cast<int32_t>(stats.freesLastTick));
+            drawCell(context, x + columnX[7], y, StringIds::entity_pool_stats_last_tick_value, lastTick);
+
+            y += rowHeight;
+        }
+    }
+
+    static void onMouseUp(Ui::window* const self, const widget_index widgetIndex)
+    {
+        switch (widgetIndex)
+        {
+            case widx::close:
+                WindowManager::close(self->type);
+                break;
+
+            case widx::saveLog:
+                EntityManager::dumpPoolStats();
+                break;
+        }
+    }
+
+    static void onUpdate(window* const self)
+    {
+        self->invalidate();
+    }
+
+    static void initEvents()
+    {
+        _events.draw = draw;
+        _events.on_mouse_up = onMouseUp;
+        _events.on_update = onUpdate;
+    }
+}
@@ -289,14 +289,9 @@ namespace OpenLoco::Ui::Windows::IndustryList
         {
             auto chosenIndustry = -1;
 
-            auto i = -1;
-
-            for (auto& industry : IndustryManager::industries())
+            for (auto& industry : IndustryManager::activeIndustries())
             {
-                i++;
-                if (industry.empty())
-                    continue;
-
+                const auto i = industry.id();
                 if ((industry.flags & IndustryFlags::sorted) != 0)
                     continue;
 
@@ -1211,11 +1206,8 @@ namespace OpenLoco::Ui::Windows::IndustryList
         {
             window->row_count = 0;
 
-            for (auto& industry : IndustryManager::industries())
+            for (auto& industry : IndustryManager::activeIndustries())
             {
-                if (industry.empty())
-                    continue;
-
                 industry.flags &= ~IndustryFlags::sorted;
             }
         }
@@ -775,13 +775,8 @@ namespace OpenLoco::Ui::Windows::MapWindow
     // 0x0046D6E1
     static void drawGraphKeyCompanies(window* self, Gfx::drawpixelinfo_t* dpi, uint16_t x, uint16_t* y)
     {
-        for (const auto& company : CompanyManager::companies())
+        for (const auto& company : CompanyManager::activeCompanies())
         {
-            if (company.empty())
-            {
-                continue;
-            }
-
             auto index = company.id();
             auto colour = Colour::getShade(company.mainColours.primary, 6);
 
@@ -866,11 +861,8 @@ namespace OpenLoco::Ui::Windows::MapWindow
         if (industryIndex == -1)
         {
             auto industryCount = 0;
-            for (const auto& industry : IndustryManager::industries())
+            for ([[maybe_unused]] const auto& industry : IndustryManager::activeIndustries())
             {
-                if (industry.empty())
-                    continue;
-
                 industryCount++;
             }
 
@@ -887,11 +879,8 @@ namespace OpenLoco::Ui::Windows::MapWindow
         else
         {
             auto industryCount = 0;
-            for (const auto& industry : IndustryManager::industries())
+            for (const auto& industry : IndustryManager::activeIndustries())
             {
-                if (industry.empty())
-                    continue;
-
                 if (industry.object_id == industryIndex)
                 {
                     industryCount++;
@@ -1090,11 +1079,12 @@ namespace OpenLoco::Ui::Windows::MapWindow
 
         xy32 startPos = { Location::null, 0 };
         xy32 endPos = { Location::null, 0 };
-        for (auto& order : Vehicles::OrderRingView(train.head->orderTableOffset))
+        for (auto& decodedOrder : Vehicles::getDecodedOrders(*train.head))
         {
+            const auto& order = *decodedOrder.order;
             if (order.hasFlag(Vehicles::OrderFlags::HasStation))
             {
-                auto* stationOrder = static_cast<Vehicles::OrderStation*>(&order);
+                auto* stationOrder = static_cast<const Vehicles::OrderStation*>(&order);
                 auto station = StationManager::get(stationOrder->getStation());
                 Pos2 stationPos = { station->x, station->y };
 
@@ -1378,11 +1368,8 @@ namespace OpenLoco::Ui::Windows::MapWindow
     // 0x0046C481
     static void drawTownNames(Gfx::drawpixelinfo_t* dpi)
     {
-        for (const auto& town : TownManager::towns())
+        for (const auto& town : TownManager::activeTowns())
         {
-            if (town.empty())
-                continue;
-
             auto townPos = locationToMapWindowPos({ town.x, town.y });
 
             StringManager::formatString(_stringFormatBuffer, town.name);
@@ -73,12 +73,9 @@ namespace OpenLoco::Ui::Windows::PlayerInfoPanel
     {
         _sortedCompanies.clear();
 
-        for (const auto& c : CompanyManager::companies())
+        for (const auto& c : CompanyManager::activeCompanies())
         {
-            if (!c.empty())
-            {
-                _sortedCompanies.push_back(&c);
-            }
+            _sortedCompanies.push_back(&c);
         }
 
         sort(
@@ -131,11 +131,8 @@ namespace OpenLoco::Ui::Windows::StationList
     {
         window->row_count = 0;
 
-        for (auto& station : StationManager::stations())
+        for (auto& station : StationManager::activeStations())
         {
-            if (station.empty())
-                continue;
-
             if (station.owner == window->number)
             {
                 station.flags &= ~StationFlags::flag_4;
@@ -225,14 +222,9 @@ namespace OpenLoco::Ui::Windows::StationList
     {
         auto edi = -1;
 
-        auto i = -1;
-
-        for (auto& station : StationManager::stations())
+        for (auto& station : StationManager::activeStations())
         {
-            i++;
-            if (station.empty())
-                continue;
-
+            const auto i = station.id();
             if (station.owner != window->number)
                 continue;
 
@@ -276,21 +276,22 @@ namespace OpenLoco::Ui::Windows::ToolbarTop::Game
     {
         Dropdown::add(0, StringIds::cheats);
         Dropdown::add(1, StringIds::tile_inspector);
-        Dropdown::add(2, 0);
-        Dropdown::add(3, StringIds::dropdown_without_checkmark, StringIds::cheat_enable_sandbox_mode);
-        Dropdown::add(4, StringIds::dropdown_without_checkmark, StringIds::cheat_allow_building_while_paused);
-        Dropdown::add(5, StringIds::dropdown_without_checkmark, StringIds::cheat_allow_manual_driving);
+        Dropdown::add(2, StringIds::entity_pool_stats);
+        Dropdown::add(3, 0);
+        Dropdown::add(4, StringIds::dropdown_without_checkmark, StringIds::cheat_enable_sandbox_mode);
+        Dropdown::add(5, StringIds::dropdown_without_checkmark, StringIds::cheat_allow_building_while_paused);
+        Dropdown::add(6, StringIds::dropdown_without_checkmark, StringIds::cheat_allow_manual_driving);
 
-        Dropdown::showBelow(window, widgetIndex, 6, 0);
+        Dropdown::showBelow(window, widgetIndex, 7, 0);
 
         if (isSandboxMode())
-            Dropdown::setItemSelected(3);
+            Dropdown::setItemSelected(4);
 
         if (isPauseOverrideEnabled())
-            Dropdown::setItemSelected(4);
+            Dropdown::setItemSelected(5);
 
         if (isDriverCheatEnabled())
-            Dropdown::setItemSelected(5);
+            Dropdown::setItemSelected(6);
     }
 
     static void cheatsMenuDropdown(window* window, widget_index widgetIndex, int16_t itemIndex)
@@ -308,21 +309,25 @@ namespace OpenLoco::Ui::Windows::ToolbarTop::Game
                 TileInspector::open();
                 break;
 
-            case 3:
+            case 2:
+                EntityPoolStats::open();
+                break;
+
+            case 4:
                 if (!isSandboxMode())
                     setScreenFlag(ScreenFlags::sandboxMode);
                 else
                     clearScreenFlag(ScreenFlags::sandboxMode);
                 break;
 
-            case 4:
+            case 5:
                 if (!isPauseOverrideEnabled())
                     setScreenFlag(ScreenFlags::pauseOverrideEnabled);
                 else
                     clearScreenFlag(ScreenFlags::pauseOverrideEnabled);
                 break;
 
-            case 5:
+            case 6:
                 if (!isDriverCheatEnabled())
                     setScreenFlag(ScreenFlags::driverCheatEnabled);
                 else
@@ -360,14 +360,9 @@ namespace OpenLoco::Ui::Windows::TownList
         {
             auto chosenTown = -1;
 
-            auto i = -1;
-
-            for (auto& town : TownManager::towns())
+            for (auto& town : TownManager::activeTowns())
             {
-                i++;
-                if (town.empty())
-                    continue;
-
+                const auto i = town.id();
                 if ((town.flags & TownFlags::sorted) != 0)
                     continue;
 
@@ -1507,11 +1502,8 @@ namespace OpenLoco::Ui::Windows::TownList
         {
             self->row_count = 0;
 
-            for (auto& town : TownManager::towns())
+            for (auto& town : TownManager::activeTowns())
             {
-                if (town.empty())
-                    continue;
-
                 town.flags &= ~TownFlags::sorted;
             }
         }
@@ -2760,8 +2760,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
         static void getScrollSize(Ui::window* const self, const uint32_t scrollIndex, uint16_t* const width, uint16_t* const height)
         {
             auto head = Common::getVehicle(self);
-            auto table = getOrderTable(head);
-            *height = lineHeight * std::distance(table.begin(), table.end());
+            *height = lineHeight * Vehicles::getDecodedOrders(*head).size();
 
             // Space for the 'end of orders' item
             *height += lineHeight;
@@ -2785,10 +2784,12 @@ namespace OpenLoco::Ui::Windows::Vehicle
                 {
                     // Copy complete order list
                     Audio::playSound(Audio::SoundId::waypoint, { x, y, Input::getDragLastLocation().x }, Input::getDragLastLocation().x);
-                    std::vector<std::shared_ptr<Vehicles::Order>> clonedOrders;
-                    for (auto& existingOrders : getOrderTable(head))
+                    const auto existingOrders = Vehicles::getDecodedOrders(*head);
+                    std::vector<Vehicles::OrderValue> clonedOrders;
+                    clonedOrders.reserve(existingOrders.size());
+                    for (auto& existingOrder : existingOrders)
                     {
-                        clonedOrders.push_back(existingOrders.clone());
+                        clonedOrders.push_back(existingOrder.order);
                     }
                     for (auto& order : clonedOrders)
                     {
@@ -2800,7 +2801,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
                 {
                     // Copy a single entry on the order list
                     Audio::playSound(Audio::SoundId::waypoint, { x, y, Input::getDragLastLocation().x }, Input::getDragLastLocation().x);
-                    auto clonedOrder = selectedOrder->clone();
+                    auto clonedOrder = selectedOrder->copy();
                     addNewOrder(toolWindow, *clonedOrder);
                     WindowManager::bringToFront(toolWindow);
                 }
@@ -3074,7 +3075,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
         };
 
         // 0x004B4A58 based on
-        static void sub_4B4A58(window* const self, Gfx::drawpixelinfo_t* const context, const string_id strFormat, FormatArguments& args, Vehicles::Order& order, int16_t& y)
+        static void sub_4B4A58(window* const self, Gfx::drawpixelinfo_t* const context, const string_id strFormat, FormatArguments& args, const Vehicles::Order& order, int16_t& y)
         {
             Gfx::point_t loc = { 8, static_cast<int16_t>(y - 1) };
             Gfx::drawString_494B3F(*context, &loc, Colour::black, strFormat, &args);
@@ -3105,8 +3106,9 @@ namespace OpenLoco::Ui::Windows::Vehicle
             }
 
             _113646A = 1; // Number ?symbol? TODO: make not a global
-            for (auto& order : getOrderTable(head))
+            for (auto& decodedOrder : Vehicles::getDecodedOrders(*head))
             {
+                const auto& order = *decodedOrder.order;
                 int16_t y = rowNum * lineHeight;
                 auto strFormat = StringIds::black_stringid;
                 if (self->var_842 == rowNum)
@@ -3131,7 +3133,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
                     case Vehicles::OrderType::StopAt:
                     case Vehicles::OrderType::RouteThrough:
                     {
-                        auto* stationOrder = static_cast<Vehicles::OrderStation*>(&order);
+                        auto* stationOrder = static_cast<const Vehicles::OrderStation*>(&order);
                         stationOrder->setFormatArguments(args);
                         break;
                     }
@@ -3139,14 +3141,14 @@ namespace OpenLoco::Ui::Windows::Vehicle
                     case Vehicles::OrderType::WaitFor:
                     {
 
-                        auto* cargoOrder = static_cast<Vehicles::OrderCargo*>(&order);
+                        auto* cargoOrder = static_cast<const Vehicles::OrderCargo*>(&order);
                         cargoOrder->setFormatArguments(args);
                         break;
                     }
                 }
 
                 sub_4B4A58(self, pDrawpixelinfo, strFormat, args, order, y);
-                if (head->currentOrder + head->orderTableOffset == order.getOffset())
+                if (head->currentOrder == decodedOrder.offset)
                 {
                     Gfx::drawString_494B3F(*pDrawpixelinfo, 1, y - 1, Colour::black, StringIds::orders_current_order);
                 }
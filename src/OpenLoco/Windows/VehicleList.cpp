@@ -824,12 +824,11 @@ namespace OpenLoco::Ui::Windows::VehicleList
         buffer = head->generateCargoTotalString(buffer);
 
         // Figure out what stations the vehicle stops at.
-        auto orders = Vehicles::OrderRingView(head->orderTableOffset);
         bool isFirstStop = true;
-        for (auto& order : orders)
+        for (auto& decodedOrder : Vehicles::getDecodedOrders(*head))
         {
             // Is this order a station?
-            auto* stopOrder = order.as<Vehicles::OrderStopAt>();
+            auto* stopOrder = decodedOrder.order->as<Vehicles::OrderStopAt>();
             if (stopOrder == nullptr)
                 continue;
 